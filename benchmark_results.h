@@ -0,0 +1,517 @@
+#ifndef BENCHMARK_RESULTS_H
+#define BENCHMARK_RESULTS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <math.h>
+#include <time.h>
+
+// File metadata dataset yang ditulis oleh generate_data.c
+#define DATA_META_FILE "data_meta.txt"
+#define BENCH_FIELD_LENGTH 128
+
+// === Struktur Data Hasil Benchmark ===
+
+// Metadata satu kali run benchmark
+typedef struct {
+    char timestamp[32];
+    char git_commit[BENCH_FIELD_LENGTH];
+    char compiler[BENCH_FIELD_LENGTH];
+    char compiler_flags[BENCH_FIELD_LENGTH];
+    char cpu_model[BENCH_FIELD_LENGTH];
+    char dataset_seed[BENCH_FIELD_LENGTH];
+    char dataset_distribution[BENCH_FIELD_LENGTH];
+    char sort_isa[16]; // Level ISA kernel yang dipakai (diisi pemanggil)
+    char buffer_pages[16]; // Jenis halaman buffer pool (diisi pemanggil)
+} BenchMeta;
+
+// Hasil satu (algoritma, tipe data, ukuran) dengan statistik pengulangan
+typedef struct {
+    char algo[32];
+    char data_type[16];
+    size_t size;
+    int reps;
+    double mean_sec;
+    double stddev_sec;
+    long memory_kb;
+} BenchResult;
+
+// Array dinamis BenchResult
+typedef struct {
+    BenchResult *items;
+    size_t count;
+    size_t capacity;
+} BenchResultList;
+
+// Ambang mode perbandingan (lihat compare_bench_results)
+typedef struct {
+    double time_threshold; // Perlambatan relatif minimum (0.05 = 5%)
+    double mem_threshold;  // Kenaikan memori relatif minimum
+    double alpha;          // Taraf signifikansi uji t Welch satu sisi (0.01 = 99%)
+    double min_time_sec;   // Baris dengan mean baseline & baru di bawah ini tidak dinilai
+    double min_delta_sec;  // Selisih mean absolut minimum agar dianggap regresi
+} BenchCompareOptions;
+
+// === Helper Functions ===
+
+// Menyalin string dengan aman dan mengganti tab/newline agar format file tetap valid
+void bench_copy_field(char *dst, size_t dst_size, const char *src) {
+    size_t i;
+    if (dst_size == 0) return;
+    for (i = 0; i + 1 < dst_size && src && src[i] != '\0'; i++) {
+        dst[i] = (src[i] == '\t' || src[i] == '\n' || src[i] == '\r') ? ' ' : src[i];
+    }
+    dst[i] = '\0';
+}
+
+/**
+ * @brief Menambahkan satu hasil ke list.
+ * @return 1 jika berhasil, 0 jika alokasi memori gagal.
+ */
+int bench_list_add(BenchResultList *list, const BenchResult *result) {
+    if (list->count == list->capacity) {
+        size_t new_capacity = list->capacity ? list->capacity * 2 : 64;
+        BenchResult *temp = (BenchResult *)realloc(list->items, new_capacity * sizeof(BenchResult));
+        if (!temp) {
+            perror("Gagal alokasi memori untuk daftar hasil benchmark");
+            return 0;
+        }
+        list->items = temp;
+        list->capacity = new_capacity;
+    }
+    list->items[list->count++] = *result;
+    return 1;
+}
+
+void bench_list_free(BenchResultList *list) {
+    free(list->items);
+    list->items = NULL;
+    list->count = 0;
+    list->capacity = 0;
+}
+
+// Membaca satu baris output perintah shell (misal git), atau "unknown"
+void bench_read_command(const char *command, char *out, size_t out_size) {
+    bench_copy_field(out, out_size, "unknown");
+#if defined(__linux__) || defined(__APPLE__)
+    FILE *pipe = popen(command, "r");
+    if (!pipe) return;
+    char line[BENCH_FIELD_LENGTH];
+    if (fgets(line, sizeof(line), pipe)) {
+        line[strcspn(line, "\r\n")] = 0;
+        if (line[0] != '\0') bench_copy_field(out, out_size, line);
+    }
+    pclose(pipe);
+#else
+    (void)command;
+#endif
+}
+
+/**
+ * @brief Mengumpulkan metadata run: commit git, compiler & flag, model CPU,
+ *        seed dan distribusi dataset.
+ * @prinsip Commit dan flag diambil dari makro saat kompilasi (GIT_COMMIT,
+ *          BUILD_FLAGS) agar sesuai dengan binary yang benar-benar diuji;
+ *          jika tidak didefinisikan, commit dibaca dari `git rev-parse`.
+ *          Seed dan distribusi dibaca dari DATA_META_FILE.
+ */
+void collect_bench_meta(BenchMeta *meta) {
+    time_t now = time(NULL);
+    struct tm *tm_now = localtime(&now);
+    memset(meta, 0, sizeof(*meta));
+    if (tm_now) strftime(meta->timestamp, sizeof(meta->timestamp), "%Y-%m-%dT%H:%M:%S", tm_now);
+
+#ifdef GIT_COMMIT
+    bench_copy_field(meta->git_commit, sizeof(meta->git_commit), GIT_COMMIT);
+#else
+    bench_read_command("git rev-parse --short HEAD 2>/dev/null", meta->git_commit, sizeof(meta->git_commit));
+#endif
+
+#if defined(__clang__)
+    bench_copy_field(meta->compiler, sizeof(meta->compiler), "clang " __clang_version__);
+#elif defined(__GNUC__)
+    bench_copy_field(meta->compiler, sizeof(meta->compiler), "gcc " __VERSION__);
+#elif defined(_MSC_VER)
+    snprintf(meta->compiler, sizeof(meta->compiler), "msvc %d", _MSC_VER);
+#else
+    bench_copy_field(meta->compiler, sizeof(meta->compiler), "unknown");
+#endif
+
+#ifdef BUILD_FLAGS
+    bench_copy_field(meta->compiler_flags, sizeof(meta->compiler_flags), BUILD_FLAGS);
+#else
+    bench_copy_field(meta->compiler_flags, sizeof(meta->compiler_flags), "unknown");
+#endif
+
+    bench_copy_field(meta->cpu_model, sizeof(meta->cpu_model), "unknown");
+#if defined(__linux__)
+    FILE *cpu = fopen("/proc/cpuinfo", "r");
+    if (cpu) {
+        char line[256];
+        while (fgets(line, sizeof(line), cpu)) {
+            if (strncmp(line, "model name", 10) == 0) {
+                char *colon = strchr(line, ':');
+                if (colon) {
+                    colon++;
+                    while (*colon == ' ') colon++;
+                    line[strcspn(line, "\r\n")] = 0;
+                    bench_copy_field(meta->cpu_model, sizeof(meta->cpu_model), colon);
+                }
+                break;
+            }
+        }
+        fclose(cpu);
+    }
+#elif defined(__APPLE__)
+    bench_read_command("sysctl -n machdep.cpu.brand_string", meta->cpu_model, sizeof(meta->cpu_model));
+#endif
+
+    bench_copy_field(meta->dataset_seed, sizeof(meta->dataset_seed), "unknown");
+    bench_copy_field(meta->dataset_distribution, sizeof(meta->dataset_distribution), "unknown");
+    FILE *fp = fopen(DATA_META_FILE, "r");
+    if (fp) {
+        char line[256];
+        while (fgets(line, sizeof(line), fp)) {
+            line[strcspn(line, "\r\n")] = 0;
+            if (strncmp(line, "seed=", 5) == 0)
+                bench_copy_field(meta->dataset_seed, sizeof(meta->dataset_seed), line + 5);
+            else if (strncmp(line, "distribution=", 13) == 0)
+                bench_copy_field(meta->dataset_distribution, sizeof(meta->dataset_distribution), line + 13);
+        }
+        fclose(fp);
+    }
+}
+
+// Mengembalikan field BenchMeta untuk kunci "meta" di file hasil, NULL jika tidak dikenal
+char *bench_meta_field(BenchMeta *meta, const char *key, size_t *size) {
+#define BENCH_META_KEY(name) \
+    if (strcmp(key, #name) == 0) { *size = sizeof(meta->name); return meta->name; }
+    BENCH_META_KEY(git_commit)
+    BENCH_META_KEY(compiler)
+    BENCH_META_KEY(compiler_flags)
+    BENCH_META_KEY(cpu_model)
+    BENCH_META_KEY(dataset_seed)
+    BENCH_META_KEY(dataset_distribution)
+    BENCH_META_KEY(sort_isa)
+    BENCH_META_KEY(buffer_pages)
+#undef BENCH_META_KEY
+    return NULL;
+}
+
+// === Penyimpanan Hasil ===
+
+/**
+ * @brief Menambahkan satu run (metadata + semua hasil) ke akhir file hasil.
+ * @prinsip Format teks dipisah tab, satu blok per run:
+ *            run <timestamp>
+ *            meta <kunci> <nilai>      (beberapa baris)
+ *            result <algo> <tipe> <ukuran> <reps> <mean_s> <stddev_s> <mem_kb>
+ *            end
+ *          File hanya ditambah (append) sehingga riwayat run tetap tersimpan.
+ * @return 1 jika berhasil, 0 jika file tidak bisa ditulis.
+ */
+int append_bench_results(const char *filename, const BenchMeta *meta, const BenchResultList *list) {
+    FILE *fp = fopen(filename, "a");
+    if (!fp) {
+        perror("Error membuka file hasil benchmark");
+        return 0;
+    }
+    fprintf(fp, "run\t%s\n", meta->timestamp);
+    fprintf(fp, "meta\tgit_commit\t%s\n", meta->git_commit);
+    fprintf(fp, "meta\tcompiler\t%s\n", meta->compiler);
+    fprintf(fp, "meta\tcompiler_flags\t%s\n", meta->compiler_flags);
+    fprintf(fp, "meta\tcpu_model\t%s\n", meta->cpu_model);
+    fprintf(fp, "meta\tdataset_seed\t%s\n", meta->dataset_seed);
+    fprintf(fp, "meta\tdataset_distribution\t%s\n", meta->dataset_distribution);
+    fprintf(fp, "meta\tsort_isa\t%s\n", meta->sort_isa[0] ? meta->sort_isa : "unknown");
+    fprintf(fp, "meta\tbuffer_pages\t%s\n", meta->buffer_pages[0] ? meta->buffer_pages : "unknown");
+    for (size_t i = 0; i < list->count; i++) {
+        const BenchResult *r = &list->items[i];
+        fprintf(fp, "result\t%s\t%s\t%zu\t%d\t%.9f\t%.9f\t%ld\n",
+                r->algo, r->data_type, r->size, r->reps, r->mean_sec, r->stddev_sec, r->memory_kb);
+    }
+    fprintf(fp, "end\n");
+    fclose(fp);
+    return 1;
+}
+
+/**
+ * @brief Membaca blok run terakhir yang lengkap dari file hasil sebagai baseline.
+ * @param filename File hasil (format append_bench_results).
+ * @param list List output (harus kosong); diisi hasil run terakhir.
+ * @param meta Metadata run tersebut (boleh NULL); field yang tidak ada di file dibiarkan kosong.
+ * @return 1 jika ada run lengkap yang terbaca, 0 jika tidak.
+ */
+int load_last_bench_run(const char *filename, BenchResultList *list, BenchMeta *meta) {
+    FILE *fp = fopen(filename, "r");
+    if (!fp) {
+        perror("Error membuka file baseline benchmark");
+        return 0;
+    }
+    BenchResultList current = {NULL, 0, 0};
+    BenchMeta current_meta;
+    int found = 0;
+    char line[512];
+    memset(&current_meta, 0, sizeof(current_meta));
+    while (fgets(line, sizeof(line), fp)) {
+        line[strcspn(line, "\r\n")] = 0;
+        if (strncmp(line, "run\t", 4) == 0) {
+            current.count = 0; // Mulai blok baru
+            memset(&current_meta, 0, sizeof(current_meta));
+            bench_copy_field(current_meta.timestamp, sizeof(current_meta.timestamp), line + 4);
+        } else if (strncmp(line, "meta\t", 5) == 0) {
+            char *key = line + 5;
+            char *value = strchr(key, '\t');
+            if (!value) continue;
+            *value++ = '\0';
+            size_t size;
+            char *field = bench_meta_field(&current_meta, key, &size);
+            if (field) bench_copy_field(field, size, value);
+        } else if (strncmp(line, "result\t", 7) == 0) {
+            BenchResult r;
+            memset(&r, 0, sizeof(r));
+            char *fields[8];
+            int nf = 0;
+            char *p = line;
+            while (nf < 8) {
+                fields[nf++] = p;
+                p = strchr(p, '\t');
+                if (!p) break;
+                *p++ = '\0';
+            }
+            if (nf != 8) continue; // Baris rusak, lewati
+            bench_copy_field(r.algo, sizeof(r.algo), fields[1]);
+            bench_copy_field(r.data_type, sizeof(r.data_type), fields[2]);
+            r.size = (size_t)strtoull(fields[3], NULL, 10);
+            r.reps = atoi(fields[4]);
+            r.mean_sec = strtod(fields[5], NULL);
+            r.stddev_sec = strtod(fields[6], NULL);
+            r.memory_kb = strtol(fields[7], NULL, 10);
+            if (!bench_list_add(&current, &r)) break;
+        } else if (strcmp(line, "end") == 0) {
+            // Blok lengkap: jadikan kandidat baseline
+            bench_list_free(list);
+            list->items = (BenchResult *)malloc((current.count ? current.count : 1) * sizeof(BenchResult));
+            if (!list->items) {
+                perror("Gagal alokasi memori untuk baseline benchmark");
+                break;
+            }
+            memcpy(list->items, current.items, current.count * sizeof(BenchResult));
+            list->count = current.count;
+            list->capacity = current.count;
+            if (meta) *meta = current_meta;
+            found = 1;
+        }
+    }
+    bench_list_free(&current);
+    fclose(fp);
+    return found;
+}
+
+// === Mode Perbandingan (Regresi) ===
+
+// Continued fraction untuk fungsi beta tak lengkap (metode Lentz)
+double bench_beta_cf(double a, double b, double x) {
+    const double eps = 1e-12, tiny = 1e-300;
+    double c = 1.0, d = 1.0 - (a + b) * x / (a + 1.0);
+    if (fabs(d) < tiny) d = tiny;
+    d = 1.0 / d;
+    double h = d;
+    for (int m = 1; m <= 300; m++) {
+        double aa = m * (b - m) * x / ((a + 2 * m - 1) * (a + 2 * m));
+        d = 1.0 + aa * d; if (fabs(d) < tiny) d = tiny;
+        c = 1.0 + aa / c; if (fabs(c) < tiny) c = tiny;
+        d = 1.0 / d;
+        h *= d * c;
+        aa = -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 2 * m + 1));
+        d = 1.0 + aa * d; if (fabs(d) < tiny) d = tiny;
+        c = 1.0 + aa / c; if (fabs(c) < tiny) c = tiny;
+        d = 1.0 / d;
+        double del = d * c;
+        h *= del;
+        if (fabs(del - 1.0) < eps) break;
+    }
+    return h;
+}
+
+// Fungsi beta tak lengkap teregularisasi I_x(a, b)
+double bench_incomplete_beta(double a, double b, double x) {
+    if (x <= 0.0) return 0.0;
+    if (x >= 1.0) return 1.0;
+    double front = exp(lgamma(a + b) - lgamma(a) - lgamma(b) + a * log(x) + b * log(1.0 - x));
+    if (x < (a + 1.0) / (a + b + 2.0)) return front * bench_beta_cf(a, b, x) / a;
+    return 1.0 - front * bench_beta_cf(b, a, 1.0 - x) / b;
+}
+
+// P(T > t) untuk distribusi t Student dengan df derajat kebebasan (t >= 0, df boleh pecahan)
+double bench_t_tail(double t, double df) {
+    return 0.5 * bench_incomplete_beta(df / 2.0, 0.5, df / (df + t * t));
+}
+
+/**
+ * @brief Nilai kritis satu sisi t_{1-alpha, df}.
+ * @prinsip Invers bench_t_tail dengan bisection. Contoh alpha = 0.01:
+ *          df 2 -> 6.96, df 4 -> 3.75, df 30 -> 2.46, df besar -> 2.33.
+ */
+double bench_t_critical(double df, double alpha) {
+    double lo = 0.0, hi = 1.0;
+    while (bench_t_tail(hi, df) > alpha && hi < 1e6) hi *= 2.0;
+    for (int i = 0; i < 100; i++) {
+        double mid = 0.5 * (lo + hi);
+        if (bench_t_tail(mid, df) > alpha) lo = mid;
+        else hi = mid;
+    }
+    return hi;
+}
+
+/**
+ * @brief Mencetak peringatan jika metadata baseline berbeda dari run saat ini.
+ * @prinsip CPU, compiler, flag, dataset, level ISA, dan jenis halaman yang
+ *          berbeda membuat selisih waktu bukan lagi akibat perubahan kode.
+ *          Field yang kosong (file lama) atau "unknown" di salah satu sisi
+ *          dilewati. Commit dan timestamp memang diharapkan berbeda.
+ * @return Jumlah field yang berbeda.
+ */
+int warn_bench_meta_mismatch(const BenchMeta *baseline, const BenchMeta *current) {
+    static const char *keys[] = {"cpu_model", "compiler", "compiler_flags", "dataset_seed",
+                                 "dataset_distribution", "sort_isa", "buffer_pages"};
+    BenchMeta base = *baseline, cur = *current;
+    int mismatches = 0;
+    for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); i++) {
+        size_t size;
+        const char *b = bench_meta_field(&base, keys[i], &size);
+        const char *c = bench_meta_field(&cur, keys[i], &size);
+        if (b[0] == '\0' || c[0] == '\0' || strcmp(b, "unknown") == 0 || strcmp(c, "unknown") == 0) continue;
+        if (strcmp(b, c) != 0) {
+            fprintf(stderr, "Warning: %s baseline berbeda: '%s' (baseline %s) vs '%s' (run ini)\n",
+                    keys[i], b, baseline->timestamp, c);
+            mismatches++;
+        }
+    }
+    if (mismatches > 0)
+        fprintf(stderr, "Warning: Perbandingan mungkin tidak valid karena lingkungan run berbeda.\n");
+    return mismatches;
+}
+
+// Pembanding double untuk qsort (menghitung median rasio waktu)
+int bench_compare_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Membandingkan run saat ini dengan baseline per (algoritma, tipe, ukuran).
+ * @prinsip Sebuah hasil dianggap regresi waktu jika semua syarat terpenuhi:
+ *          lebih lambat dari baseline lebih dari time_threshold (relatif),
+ *          selisih mean minimal min_delta_sec, salah satu mean minimal
+ *          min_time_sec (pengukuran clock() di bawahnya didominasi noise), dan
+ *          perbedaannya signifikan: statistik t Welch
+ *          (mean_baru - mean_lama) / sqrt(s1^2/n1 + s0^2/n0) melebihi nilai
+ *          kritis satu sisi untuk alpha pada derajat kebebasan
+ *          Welch-Satterthwaite. Jika salah satu sisi hanya 1 pengulangan,
+ *          simpangan tidak diketahui sehingga uji t tidak bisa dilakukan dan
+ *          perlambatannya tidak pernah dihitung sebagai regresi. Perlambatan
+ *          yang gagal salah satu syarat ditampilkan "TIDAK SIGNIFIKAN".
+ *          Regresi memori ditandai jika puncak memori naik lebih dari
+ *          mem_threshold (relatif) dan minimal 256 KB; karena file hasil hanya
+ *          menyimpan puncak terbesar (tanpa sebaran), kenaikan memori tidak
+ *          diuji signifikansinya. Median rasio waktu baru/baseline dari semua
+ *          baris yang terukur juga dilaporkan: jika seluruh run bergeser
+ *          melewati time_threshold, kemungkinan besar mesinnya yang berubah
+ *          (beban, frekuensi), bukan kodenya, dan hal itu diperingatkan.
+ * @return Jumlah regresi yang ditemukan (0 berarti lolos).
+ */
+int compare_bench_results(const BenchResultList *baseline, const BenchResultList *current,
+                          const BenchCompareOptions *opt) {
+    int regressions = 0;
+    size_t untested = 0;
+    size_t ratio_count = 0;
+    double *ratios = (double *)malloc((current->count ? current->count : 1) * sizeof(double));
+    printf("\n===== PERBANDINGAN DENGAN BASELINE =====\n");
+    printf("%-24s %-6s %10s %12s %12s %8s %7s %7s  %s\n",
+           "Algoritma", "Tipe", "Ukuran", "Base (s)", "Baru (s)", "Delta", "t", "t_krit", "Status");
+    for (size_t i = 0; i < current->count; i++) {
+        const BenchResult *cur = &current->items[i];
+        const BenchResult *base = NULL;
+        for (size_t j = 0; j < baseline->count; j++) {
+            const BenchResult *b = &baseline->items[j];
+            if (b->size == cur->size && strcmp(b->algo, cur->algo) == 0 && strcmp(b->data_type, cur->data_type) == 0) {
+                base = b;
+                break;
+            }
+        }
+        if (!base) {
+            printf("%-24s %-6s %10zu %12s %12.6f %8s %7s %7s  BARU\n",
+                   cur->algo, cur->data_type, cur->size, "-", cur->mean_sec, "-", "-", "-");
+            continue;
+        }
+
+        double delta = base->mean_sec > 0 ? (cur->mean_sec - base->mean_sec) / base->mean_sec : 0.0;
+        if (ratios && base->mean_sec >= opt->min_time_sec && cur->mean_sec >= opt->min_time_sec)
+            ratios[ratio_count++] = cur->mean_sec / base->mean_sec;
+        double t_stat = 0.0, t_crit = 0.0;
+        int have_variance = cur->reps > 1 && base->reps > 1;
+        if (have_variance) {
+            double v_cur = cur->stddev_sec * cur->stddev_sec / cur->reps;
+            double v_base = base->stddev_sec * base->stddev_sec / base->reps;
+            double se = sqrt(v_cur + v_base);
+            t_stat = se > 0 ? (cur->mean_sec - base->mean_sec) / se
+                            : (cur->mean_sec > base->mean_sec ? INFINITY : 0.0);
+            // Derajat kebebasan Welch-Satterthwaite (tanpa varians: df gabungan)
+            double denom = v_cur * v_cur / (cur->reps - 1) + v_base * v_base / (base->reps - 1);
+            double df = denom > 0 ? (v_cur + v_base) * (v_cur + v_base) / denom
+                                  : (double)(cur->reps + base->reps - 2);
+            t_crit = bench_t_critical(df, opt->alpha);
+        }
+        int measurable = (cur->mean_sec >= opt->min_time_sec || base->mean_sec >= opt->min_time_sec) &&
+                         cur->mean_sec - base->mean_sec >= opt->min_delta_sec;
+        int slower = delta > opt->time_threshold;
+        int slow = slower && measurable && have_variance && t_stat > t_crit;
+        int mem_grow = base->memory_kb > 0 && cur->memory_kb > 0 &&
+                       cur->memory_kb - base->memory_kb > 256 &&
+                       (double)(cur->memory_kb - base->memory_kb) / base->memory_kb > opt->mem_threshold;
+
+        const char *status = "OK";
+        if (slow && mem_grow) status = "REGRESI WAKTU+MEMORI";
+        else if (slow) status = "REGRESI WAKTU";
+        else if (mem_grow) status = "REGRESI MEMORI";
+        else if (slower) status = "TIDAK SIGNIFIKAN";
+        if (slow || mem_grow) regressions++;
+        if (!have_variance) untested++;
+
+        if (have_variance) {
+            printf("%-24s %-6s %10zu %12.6f %12.6f %+7.1f%% %7.2f %7.2f  %s\n",
+                   cur->algo, cur->data_type, cur->size, base->mean_sec, cur->mean_sec, delta * 100.0,
+                   t_stat, t_crit, status);
+        } else {
+            printf("%-24s %-6s %10zu %12.6f %12.6f %+7.1f%% %7s %7s  %s\n",
+                   cur->algo, cur->data_type, cur->size, base->mean_sec, cur->mean_sec, delta * 100.0, "-", "-", status);
+        }
+        if (mem_grow) {
+            printf("%-24s %-6s %10s   memori: %ld KB -> %ld KB\n", "", "", "", base->memory_kb, cur->memory_kb);
+        }
+    }
+    printf("Total regresi: %d\n", regressions);
+    if (untested > 0) {
+        fprintf(stderr, "Warning: %zu baris hanya punya 1 pengulangan di salah satu sisi; perlambatannya tidak diuji "
+                        "dan tidak dihitung sebagai regresi (jalankan baseline dan run ini dengan --repeat >= 2).\n",
+                untested);
+    }
+    if (ratio_count >= 5) {
+        qsort(ratios, ratio_count, sizeof(double), bench_compare_double);
+        double median = ratio_count % 2 ? ratios[ratio_count / 2]
+                                        : 0.5 * (ratios[ratio_count / 2 - 1] + ratios[ratio_count / 2]);
+        printf("Median perubahan waktu (%zu baris >= %.0f ms): %+.1f%%\n",
+               ratio_count, opt->min_time_sec * 1000.0, (median - 1.0) * 100.0);
+        if (fabs(median - 1.0) > opt->time_threshold) {
+            fprintf(stderr, "Warning: Seluruh run bergeser %+.1f%% (median); beban atau frekuensi mesin kemungkinan "
+                            "berbeda dari baseline, regresi di atas bisa semu.\n", (median - 1.0) * 100.0);
+        }
+    }
+    free(ratios);
+    return regressions;
+}
+
+#endif // BENCHMARK_RESULTS_H
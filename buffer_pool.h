@@ -0,0 +1,208 @@
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Arena dibulatkan ke kelipatan ukuran huge page x86 (2 MB) dan diselaraskan
+// ke batas yang sama agar kernel bisa memetakannya dengan huge page.
+#define BUFFER_POOL_HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+#define BUFFER_POOL_ALIGNMENT 64 // Perataan minimum (cache line) untuk fallback malloc
+
+// === Jenis Halaman dan Slot Arena ===
+
+typedef enum {
+    BUFFER_PAGES_NORMAL = 0, // Halaman 4 KB biasa
+    BUFFER_PAGES_THP,        // Transparent huge page (madvise MADV_HUGEPAGE)
+    BUFFER_PAGES_HUGETLB     // Huge page eksplisit (MAP_HUGETLB, butuh vm.nr_hugepages)
+} BufferPages;
+
+// Satu arena untuk setiap peran buffer dalam benchmark
+typedef enum {
+    BUFFER_SLOT_DATA = 0, // Salinan data yang diurutkan
+    BUFFER_SLOT_SCRATCH,  // Memori kerja algoritma (temp merge, dsb.)
+    BUFFER_SLOT_COUNT
+} BufferSlot;
+
+typedef struct {
+    void *base;        // Awal area yang bisa dipakai (selaras)
+    void *raw;         // Pointer asli dari malloc (hanya untuk fallback non-mmap)
+    size_t size;       // Ukuran area yang sudah di-prefault
+    BufferPages pages; // Jenis halaman yang benar-benar didapat
+} BufferArena;
+
+typedef struct {
+    BufferPages requested;                // Jenis halaman yang diminta
+    BufferArena arenas[BUFFER_SLOT_COUNT];
+} BufferPool;
+
+const char *buffer_pages_name(BufferPages pages) {
+    switch (pages) {
+        case BUFFER_PAGES_THP:     return "thp";
+        case BUFFER_PAGES_HUGETLB: return "hugetlb";
+        case BUFFER_PAGES_NORMAL:
+        default:                   return "normal";
+    }
+}
+
+// Mengubah nama (normal|thp|hugetlb) menjadi BufferPages, -1 jika tidak dikenal
+int parse_buffer_pages(const char *name) {
+    if (strcmp(name, "normal") == 0 || strcmp(name, "none") == 0) return BUFFER_PAGES_NORMAL;
+    if (strcmp(name, "thp") == 0) return BUFFER_PAGES_THP;
+    if (strcmp(name, "hugetlb") == 0 || strcmp(name, "huge") == 0) return BUFFER_PAGES_HUGETLB;
+    return -1;
+}
+
+// === Alokasi Arena ===
+
+// Menulis satu byte per halaman agar semua halaman sudah terpetakan sebelum diukur
+void buffer_arena_prefault(BufferArena *arena) {
+    volatile unsigned char *p = (volatile unsigned char *)arena->base;
+    for (size_t off = 0; off < arena->size; off += 4096) {
+        p[off] = 0;
+    }
+    if (arena->size > 0) p[arena->size - 1] = 0;
+}
+
+void buffer_arena_release(BufferArena *arena) {
+    if (!arena->base) return;
+#if defined(__linux__)
+    munmap(arena->base, arena->size);
+#else
+    free(arena->raw);
+#endif
+    arena->base = NULL;
+    arena->raw = NULL;
+    arena->size = 0;
+    arena->pages = BUFFER_PAGES_NORMAL;
+}
+
+/**
+ * @brief Mengalokasikan satu arena selaras 2 MB dan mem-prefault semuanya.
+ * @prinsip Di Linux arena dipetakan dengan mmap. Mode HUGETLB mencoba
+ *          MAP_HUGETLB lebih dulu; jika pool huge page sistem kosong, turun ke
+ *          mmap biasa + THP. Untuk THP, area dipetakan 2 MB lebih besar, lalu
+ *          sisa di kedua ujung di-munmap agar awalnya selaras 2 MB, kemudian
+ *          ditandai MADV_HUGEPAGE. Setelah itu setiap halaman disentuh sekali
+ *          sehingga page fault dan zeroing terjadi di sini, bukan di dalam
+ *          region yang diukur. Di platform lain arena memakai malloc yang
+ *          diselaraskan ke cache line.
+ * @return 1 jika berhasil, 0 jika alokasi gagal.
+ */
+int buffer_arena_alloc(BufferArena *arena, size_t bytes, BufferPages requested) {
+    size_t size = (bytes + BUFFER_POOL_HUGE_PAGE_SIZE - 1) / BUFFER_POOL_HUGE_PAGE_SIZE * BUFFER_POOL_HUGE_PAGE_SIZE;
+    if (size == 0) size = BUFFER_POOL_HUGE_PAGE_SIZE;
+    arena->raw = NULL;
+#if defined(__linux__)
+#ifdef MAP_HUGETLB
+    if (requested == BUFFER_PAGES_HUGETLB) {
+        void *p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) {
+            arena->base = p;
+            arena->size = size;
+            arena->pages = BUFFER_PAGES_HUGETLB;
+            buffer_arena_prefault(arena);
+            return 1;
+        }
+        fprintf(stderr, "Warning: MAP_HUGETLB gagal (cek /proc/sys/vm/nr_hugepages), memakai THP\n");
+    }
+#endif
+    size_t map_size = size + BUFFER_POOL_HUGE_PAGE_SIZE;
+    unsigned char *p = (unsigned char *)mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if ((void *)p == MAP_FAILED) {
+        perror("Gagal mmap arena buffer pool");
+        return 0;
+    }
+    uintptr_t addr = (uintptr_t)p;
+    uintptr_t aligned = (addr + BUFFER_POOL_HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(BUFFER_POOL_HUGE_PAGE_SIZE - 1);
+    size_t head = (size_t)(aligned - addr);
+    size_t tail = map_size - head - size;
+    if (head > 0) munmap(p, head);
+    if (tail > 0) munmap((unsigned char *)aligned + size, tail);
+    arena->base = (void *)aligned;
+    arena->size = size;
+    arena->pages = BUFFER_PAGES_NORMAL;
+#ifdef MADV_HUGEPAGE
+    if (requested != BUFFER_PAGES_NORMAL && madvise(arena->base, size, MADV_HUGEPAGE) == 0) {
+        arena->pages = BUFFER_PAGES_THP;
+    }
+#endif
+#else
+    (void)requested;
+    arena->raw = malloc(size + BUFFER_POOL_ALIGNMENT);
+    if (!arena->raw) {
+        perror("Gagal alokasi arena buffer pool");
+        return 0;
+    }
+    uintptr_t aligned = ((uintptr_t)arena->raw + BUFFER_POOL_ALIGNMENT - 1) & ~(uintptr_t)(BUFFER_POOL_ALIGNMENT - 1);
+    arena->base = (void *)aligned;
+    arena->size = size;
+    arena->pages = BUFFER_PAGES_NORMAL;
+#endif
+    buffer_arena_prefault(arena);
+    return 1;
+}
+
+// === API Pool ===
+
+void buffer_pool_init(BufferPool *pool, BufferPages requested) {
+    memset(pool, 0, sizeof(*pool));
+    pool->requested = requested;
+}
+
+/**
+ * @brief Memastikan arena pada slot memiliki minimal `bytes` byte yang siap pakai.
+ * @prinsip Arena hanya tumbuh, tidak pernah menyusut: permintaan yang muat di
+ *          arena saat ini dikembalikan tanpa syscall apapun. Jika harus tumbuh,
+ *          arena lama dilepas dan isinya TIDAK dipertahankan. Panggil fungsi ini
+ *          di luar region yang diukur.
+ * @param pool Pool yang dipakai.
+ * @param slot Peran buffer (BUFFER_SLOT_DATA atau BUFFER_SLOT_SCRATCH).
+ * @param bytes Ukuran minimum yang dibutuhkan.
+ * @return Pointer ke awal arena (selaras), atau NULL jika alokasi gagal.
+ */
+void *buffer_pool_reserve(BufferPool *pool, BufferSlot slot, size_t bytes) {
+    BufferArena *arena = &pool->arenas[slot];
+    if (arena->base && arena->size >= bytes) return arena->base;
+    buffer_arena_release(arena);
+    if (!buffer_arena_alloc(arena, bytes, pool->requested)) return NULL;
+    return arena->base;
+}
+
+// Mengembalikan arena pada slot beserta ukurannya (NULL/0 jika belum dipesan)
+void *buffer_pool_slot(const BufferPool *pool, BufferSlot slot, size_t *bytes) {
+    const BufferArena *arena = &pool->arenas[slot];
+    if (bytes) *bytes = arena->base ? arena->size : 0;
+    return arena->base;
+}
+
+// Total huge page anonim proses dalam KB (AnonHugePages), -1 jika tidak tersedia
+long buffer_pool_huge_kb(void) {
+    long kb = -1;
+#if defined(__linux__)
+    FILE *fp = fopen("/proc/self/smaps_rollup", "r");
+    if (!fp) return -1;
+    char line[256];
+    while (fgets(line, sizeof(line), fp)) {
+        if (sscanf(line, "AnonHugePages: %ld kB", &kb) == 1) break;
+    }
+    fclose(fp);
+#endif
+    return kb;
+}
+
+void buffer_pool_free(BufferPool *pool) {
+    for (int i = 0; i < BUFFER_SLOT_COUNT; i++) {
+        buffer_arena_release(&pool->arenas[i]);
+    }
+}
+
+#endif // BUFFER_POOL_H
@@ -0,0 +1,477 @@
+#ifndef DATA_LOADER_H
+#define DATA_LOADER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h> // Untuk SIZE_MAX
+
+// Loader paralel memakai pthreads + mmap; platform lain memakai loader sekuensial.
+// Di GCC/Clang lama, kompilasi dengan -pthread.
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define DATA_LOADER_PARALLEL 1
+#else
+#define DATA_LOADER_PARALLEL 0
+#endif
+
+#define DATA_ANGKA_FILE "data_angka.txt"
+#define DATA_KATA_FILE "data_kata.txt"
+#define DATA_KATA_DUP_FILE "data_kata_dup.txt" // Kata dengan banyak duplikat (kosakata kecil)
+#define MAX_LINE_LENGTH 25
+#define DATA_LOADER_MAX_THREADS 64
+#ifndef DATA_LOADER_MIN_CHUNK
+#define DATA_LOADER_MIN_CHUNK (256 * 1024) // Byte minimum per thread agar overhead thread terbayar
+#endif
+
+// === Fungsi Helper untuk Baca Data (DIMODIFIKASI) ===
+
+/**
+ * @brief Membaca maksimal 'max_to_read' angka integer dari file.
+ * @param filename Nama file.
+ * @param arr Pointer ke pointer array (output).
+ * @param count Pointer ke size_t (output: jumlah angka yang benar-benar dibaca).
+ * @param max_to_read Jumlah maksimum angka yang akan dibaca.
+ * @return 1 jika berhasil membuka file & alokasi awal, 0 jika gagal.
+ */
+int read_numbers(const char *filename, int **arr, size_t *count, size_t max_to_read) {
+    FILE *fp = fopen(filename, "r");
+    if (!fp) {
+        perror("Error membuka file angka");
+        *arr = NULL;
+        *count = 0;
+        return 0;
+    }
+
+    // Alokasi sesuai jumlah yang diminta (cek overflow perkalian ukuran)
+    if (max_to_read > SIZE_MAX / sizeof(int)) {
+        fprintf(stderr, "Error: Jumlah angka %zu terlalu besar untuk dialokasikan\n", max_to_read);
+        fclose(fp);
+        *arr = NULL;
+        *count = 0;
+        return 0;
+    }
+    *arr = (int *)malloc(max_to_read * sizeof(int));
+    if (!*arr) {
+        perror("Gagal alokasi memori untuk array angka");
+        fclose(fp);
+        *count = 0;
+        return 0; // Gagal alokasi
+    }
+
+    size_t i = 0;
+    // Baca hingga max_to_read tercapai atau EOF
+    while (i < max_to_read && fscanf(fp, "%d", &(*arr)[i]) == 1) {
+        i++;
+    }
+
+    *count = i; // Jumlah angka yang berhasil dibaca
+
+    // Jika file lebih kecil dari yang diminta, resize (opsional tapi baik)
+    if (i < max_to_read) {
+         fprintf(stderr, "Warning: Hanya bisa membaca %zu angka dari %s (diminta %zu)\n", i, filename, max_to_read);
+         int *temp = realloc(*arr, (i ? i : 1) * sizeof(int)); // realloc(p, 0) bisa membebaskan p
+         if (temp) {
+             *arr = temp;
+         } else {
+             // Jika realloc gagal, data lama masih valid tapi ukurannya tidak optimal
+             fprintf(stderr, "Warning: Gagal realloc untuk memperkecil array angka.\n");
+         }
+    }
+
+    fclose(fp);
+    return 1; // Berhasil (setidaknya membuka file dan alokasi awal)
+}
+
+/**
+ * @brief Membaca maksimal 'max_to_read' kata dari file.
+ * @param filename Nama file.
+ * @param arr Pointer ke pointer array string (output).
+ * @param count Pointer ke size_t (output: jumlah kata yang benar-benar dibaca).
+ * @param max_to_read Jumlah maksimum kata yang akan dibaca.
+ * @return 1 jika berhasil membuka file & alokasi awal, 0 jika gagal.
+ */
+int read_words(const char *filename, char ***arr, size_t *count, size_t max_to_read) {
+    FILE *fp = fopen(filename, "r");
+    if (!fp) {
+        perror("Error membuka file kata");
+        *arr = NULL;
+        *count = 0;
+        return 0;
+    }
+
+    // Alokasi array pointer char* sesuai jumlah yang diminta (cek overflow perkalian ukuran)
+    if (max_to_read > SIZE_MAX / sizeof(char *)) {
+        fprintf(stderr, "Error: Jumlah kata %zu terlalu besar untuk dialokasikan\n", max_to_read);
+        fclose(fp);
+        *arr = NULL;
+        *count = 0;
+        return 0;
+    }
+    *arr = (char **)malloc(max_to_read * sizeof(char *));
+    if (!*arr) {
+        perror("Gagal alokasi memori untuk array pointer kata");
+        fclose(fp);
+        *count = 0;
+        return 0;
+    }
+
+    char line_buffer[MAX_LINE_LENGTH];
+    size_t i = 0;
+    while (i < max_to_read && fgets(line_buffer, sizeof(line_buffer), fp)) {
+        line_buffer[strcspn(line_buffer, "\r\n")] = 0; // Hapus newline
+
+        // Alokasi memori untuk string aktual dan salin
+        (*arr)[i] = (char *)malloc((strlen(line_buffer) + 1) * sizeof(char));
+        if (!(*arr)[i]) {
+            perror("Gagal alokasi memori untuk string kata");
+            // Cleanup memori yang sudah dialokasi dalam loop ini
+            for (size_t j = 0; j < i; j++) { free((*arr)[j]); }
+            free(*arr);
+            *arr = NULL;
+            *count = 0;
+            fclose(fp);
+            return 0; // Gagal alokasi string
+        }
+        strcpy((*arr)[i], line_buffer);
+        i++;
+    }
+
+    *count = i; // Jumlah kata yang berhasil dibaca
+
+     // Jika file lebih kecil dari yang diminta, resize array pointer
+     if (i < max_to_read) {
+         fprintf(stderr, "Warning: Hanya bisa membaca %zu kata dari %s (diminta %zu)\n", i, filename, max_to_read);
+         char **temp = realloc(*arr, (i ? i : 1) * sizeof(char *)); // realloc(p, 0) bisa membebaskan p
+         if (temp) {
+             *arr = temp;
+         } else {
+              fprintf(stderr, "Warning: Gagal realloc untuk memperkecil array pointer kata.\n");
+              // Data lama masih valid, tapi memori tidak optimal
+         }
+     }
+
+    fclose(fp);
+    return 1; // Berhasil
+}
+
+// === Loader Paralel (chunk per thread) ===
+
+#if DATA_LOADER_PARALLEL
+
+// Satu rentang byte file yang diparse oleh satu thread menjadi segmen sendiri
+typedef struct {
+    const char *begin;  // Awal rentang (selalu awal baris)
+    const char *end;    // Akhir rentang (eksklusif, selalu awal baris atau akhir file)
+    size_t limit;       // Maksimum elemen yang perlu diparse (max_to_read)
+    void *items;        // Segmen hasil: int[] (angka) atau char*[] (kata)
+    size_t count;
+    size_t capacity;
+    int stopped;        // 1 jika bertemu token bukan angka (fscanf berhenti di sini)
+    int failed;         // 1 jika alokasi gagal
+} LoaderChunk;
+
+// Jumlah thread: diminta pemanggil, atau jumlah core online; dibatasi ukuran file
+int loader_thread_count(size_t bytes, int requested) {
+    long threads = requested > 0 ? requested : sysconf(_SC_NPROCESSORS_ONLN);
+    long by_size = (long)(bytes / DATA_LOADER_MIN_CHUNK) + 1;
+    if (threads < 1) threads = 1;
+    if (threads > by_size) threads = by_size;
+    if (threads > DATA_LOADER_MAX_THREADS) threads = DATA_LOADER_MAX_THREADS;
+    return (int)threads;
+}
+
+// Memetakan seluruh file read-only; file kosong menghasilkan data NULL dan size 0
+int loader_map_file(const char *filename, const char **data, size_t *size) {
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return 0;
+    struct stat st;
+    if (fstat(fd, &st) != 0) { close(fd); return 0; }
+    *size = (size_t)st.st_size;
+    *data = NULL;
+    if (*size > 0) {
+        void *p = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) { close(fd); return 0; }
+        *data = (const char *)p;
+    }
+    close(fd);
+    return 1;
+}
+
+// Awal baris pertama yang dimulai di posisi >= pos
+const char *loader_align_line(const char *data, size_t size, size_t pos) {
+    if (pos == 0) return data;
+    if (pos >= size) return data + size;
+    const char *nl = (const char *)memchr(data + pos - 1, '\n', size - pos + 1);
+    return nl ? nl + 1 : data + size;
+}
+
+/**
+ * @brief Membagi [data, data + size) menjadi rentang yang selaras batas baris.
+ * @prinsip Batas kasar i * size / n digeser maju ke awal baris berikutnya,
+ *          sehingga setiap baris dimiliki tepat satu chunk dan urutan chunk
+ *          sama dengan urutan file.
+ */
+void loader_split_chunks(LoaderChunk chunks[], int n, const char *data, size_t size, size_t limit) {
+    memset(chunks, 0, (size_t)n * sizeof(LoaderChunk));
+    for (int t = 0; t < n; t++) {
+        chunks[t].begin = loader_align_line(data, size, size / (size_t)n * (size_t)t);
+        chunks[t].end = t + 1 < n ? loader_align_line(data, size, size / (size_t)n * (size_t)(t + 1)) : data + size;
+        chunks[t].limit = limit;
+    }
+}
+
+// Menumbuhkan segmen (kapasitas berlipat dua, tidak melebihi limit)
+int loader_chunk_grow(LoaderChunk *c, size_t elem_size) {
+    size_t cap = c->capacity ? c->capacity * 2 : 1024;
+    if (cap > c->limit) cap = c->limit;
+    void *grown = realloc(c->items, cap * elem_size);
+    if (!grown) { c->failed = 1; return 0; }
+    c->items = grown;
+    c->capacity = cap;
+    return 1;
+}
+
+/**
+ * @brief Thread parser angka: perilaku sama dengan fscanf("%d") berulang.
+ * @prinsip Lewati whitespace, tanda opsional, lalu digit. Token yang tidak
+ *          diawali angka menghentikan chunk (stopped = 1), sama seperti
+ *          read_numbers berhenti di token pertama yang gagal dibaca.
+ */
+void *parse_numbers_chunk(void *arg) {
+    LoaderChunk *c = (LoaderChunk *)arg;
+    const char *p = c->begin, *end = c->end;
+    while (c->count < c->limit) {
+        while (p < end && (*p == ' ' || (*p >= '\t' && *p <= '\r'))) p++;
+        if (p >= end) break;
+        int negative = 0;
+        const char *q = p;
+        if (*q == '-' || *q == '+') { negative = *q == '-'; q++; }
+        if (q >= end || *q < '0' || *q > '9') { c->stopped = 1; break; }
+        long long value = 0;
+        while (q < end && *q >= '0' && *q <= '9') {
+            if (value <= INT32_MAX) value = value * 10 + (*q - '0'); // Cegah overflow long long
+            q++;
+        }
+        if (c->count == c->capacity && !loader_chunk_grow(c, sizeof(int))) break;
+        ((int *)c->items)[c->count++] = (int)(negative ? -value : value);
+        p = q;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Thread parser kata: perilaku sama dengan fgets(MAX_LINE_LENGTH) berulang.
+ * @prinsip Setiap potongan berisi maksimal MAX_LINE_LENGTH - 1 byte atau
+ *          sampai '\n' (inklusif), lalu dipotong di '\r'/'\n' pertama. Baris
+ *          yang lebih panjang dari buffer menjadi beberapa kata, persis seperti
+ *          read_words. Setiap kata di-malloc sendiri agar free_words tetap bisa
+ *          dipakai.
+ */
+void *parse_words_chunk(void *arg) {
+    LoaderChunk *c = (LoaderChunk *)arg;
+    const char *p = c->begin, *end = c->end;
+    while (p < end && c->count < c->limit) {
+        size_t avail = (size_t)(end - p);
+        size_t take = avail < MAX_LINE_LENGTH - 1 ? avail : MAX_LINE_LENGTH - 1;
+        const char *nl = (const char *)memchr(p, '\n', take);
+        size_t piece = nl ? (size_t)(nl - p) + 1 : take;
+        size_t len = 0;
+        while (len < piece && p[len] != '\r' && p[len] != '\n') len++;
+        if (c->count == c->capacity && !loader_chunk_grow(c, sizeof(char *))) break;
+        char *word = (char *)malloc(len + 1);
+        if (!word) { c->failed = 1; break; }
+        memcpy(word, p, len);
+        word[len] = '\0';
+        ((char **)c->items)[c->count++] = word;
+        p += piece;
+    }
+    return NULL;
+}
+
+// Menjalankan parser di setiap chunk; chunk 0 dikerjakan thread pemanggil
+void loader_run_chunks(LoaderChunk chunks[], int n, void *(*parse)(void *)) {
+    pthread_t threads[DATA_LOADER_MAX_THREADS];
+    int started[DATA_LOADER_MAX_THREADS];
+    for (int t = 1; t < n; t++) {
+        started[t] = pthread_create(&threads[t], NULL, parse, &chunks[t]) == 0;
+        if (!started[t]) parse(&chunks[t]); // Gagal membuat thread: kerjakan langsung
+    }
+    parse(&chunks[0]);
+    for (int t = 1; t < n; t++) {
+        if (started[t]) pthread_join(threads[t], NULL);
+    }
+}
+
+/**
+ * @brief Prefix sum jumlah elemen per chunk dengan urutan file.
+ * @prinsip offsets[t] adalah posisi segmen t di array hasil. Chunk setelah
+ *          chunk yang berhenti (stopped) diabaikan, dan total dibatasi limit.
+ * @return Total elemen yang dipakai, atau SIZE_MAX jika ada chunk yang gagal.
+ */
+size_t loader_prefix_sum(const LoaderChunk chunks[], int n, size_t offsets[], size_t limit) {
+    size_t total = 0;
+    for (int t = 0; t < n; t++) {
+        if (chunks[t].failed) return SIZE_MAX;
+    }
+    for (int t = 0; t < n; t++) {
+        offsets[t] = total;
+        size_t take = chunks[t].count < limit - total ? chunks[t].count : limit - total;
+        total += take;
+        if (chunks[t].stopped || total == limit) {
+            for (int u = t + 1; u < n; u++) offsets[u] = total;
+            break;
+        }
+    }
+    return total;
+}
+
+#endif // DATA_LOADER_PARALLEL
+
+/**
+ * @brief Membaca maksimal 'max_to_read' angka integer dengan beberapa thread.
+ * @prinsip File dipetakan dengan mmap lalu dibagi menjadi rentang byte yang
+ *          selaras batas baris. Setiap thread memparse rentangnya ke segmen
+ *          sendiri, kemudian segmen digabung sesuai prefix sum jumlah elemen,
+ *          sehingga hasilnya identik (termasuk urutan) dengan read_numbers.
+ *          Tanpa dukungan pthreads, fungsi ini memanggil read_numbers.
+ * @param num_threads Jumlah thread (0 = jumlah core online, 1 = sekuensial).
+ * @return 1 jika berhasil, 0 jika gagal (sama seperti read_numbers).
+ */
+int read_numbers_parallel(const char *filename, int **arr, size_t *count, size_t max_to_read, int num_threads) {
+#if DATA_LOADER_PARALLEL
+    if (num_threads == 1 || max_to_read > SIZE_MAX / sizeof(int)) {
+        return read_numbers(filename, arr, count, max_to_read);
+    }
+    const char *data;
+    size_t size;
+    if (!loader_map_file(filename, &data, &size)) {
+        perror("Error membuka file angka");
+        *arr = NULL;
+        *count = 0;
+        return 0;
+    }
+    *arr = (int *)malloc((max_to_read ? max_to_read : 1) * sizeof(int));
+    if (!*arr) {
+        perror("Gagal alokasi memori untuk array angka");
+        if (data) munmap((void *)data, size);
+        *count = 0;
+        return 0;
+    }
+
+    int n = loader_thread_count(size, num_threads);
+    LoaderChunk chunks[DATA_LOADER_MAX_THREADS];
+    size_t offsets[DATA_LOADER_MAX_THREADS];
+    loader_split_chunks(chunks, n, data, size, max_to_read);
+    loader_run_chunks(chunks, n, parse_numbers_chunk);
+    size_t total = loader_prefix_sum(chunks, n, offsets, max_to_read);
+    for (int t = 0; t < n; t++) {
+        if (total != SIZE_MAX && offsets[t] < total) {
+            size_t take = (t + 1 < n ? offsets[t + 1] : total) - offsets[t];
+            if (take > 0) memcpy(*arr + offsets[t], chunks[t].items, take * sizeof(int));
+        }
+        free(chunks[t].items);
+    }
+    if (data) munmap((void *)data, size);
+    if (total == SIZE_MAX) {
+        perror("Gagal alokasi memori untuk segmen angka");
+        free(*arr);
+        *arr = NULL;
+        *count = 0;
+        return 0;
+    }
+
+    *count = total;
+    if (total < max_to_read) {
+        fprintf(stderr, "Warning: Hanya bisa membaca %zu angka dari %s (diminta %zu)\n", total, filename, max_to_read);
+        int *temp = realloc(*arr, (total ? total : 1) * sizeof(int));
+        if (temp) *arr = temp;
+    }
+    return 1;
+#else
+    (void)num_threads;
+    return read_numbers(filename, arr, count, max_to_read);
+#endif
+}
+
+/**
+ * @brief Membaca maksimal 'max_to_read' kata dengan beberapa thread.
+ * @prinsip Sama seperti read_numbers_parallel. Array pointer hasil digabung
+ *          lewat prefix sum; string tetap di-malloc per kata (oleh thread
+ *          parser) sehingga hasilnya dibebaskan dengan free_words. Kata dari
+ *          chunk yang melebihi max_to_read langsung dibebaskan.
+ * @param num_threads Jumlah thread (0 = jumlah core online, 1 = sekuensial).
+ * @return 1 jika berhasil, 0 jika gagal (sama seperti read_words).
+ */
+int read_words_parallel(const char *filename, char ***arr, size_t *count, size_t max_to_read, int num_threads) {
+#if DATA_LOADER_PARALLEL
+    if (num_threads == 1 || max_to_read > SIZE_MAX / sizeof(char *)) {
+        return read_words(filename, arr, count, max_to_read);
+    }
+    const char *data;
+    size_t size;
+    if (!loader_map_file(filename, &data, &size)) {
+        perror("Error membuka file kata");
+        *arr = NULL;
+        *count = 0;
+        return 0;
+    }
+    *arr = (char **)malloc((max_to_read ? max_to_read : 1) * sizeof(char *));
+    if (!*arr) {
+        perror("Gagal alokasi memori untuk array pointer kata");
+        if (data) munmap((void *)data, size);
+        *count = 0;
+        return 0;
+    }
+
+    int n = loader_thread_count(size, num_threads);
+    LoaderChunk chunks[DATA_LOADER_MAX_THREADS];
+    size_t offsets[DATA_LOADER_MAX_THREADS];
+    loader_split_chunks(chunks, n, data, size, max_to_read);
+    loader_run_chunks(chunks, n, parse_words_chunk);
+    size_t total = loader_prefix_sum(chunks, n, offsets, max_to_read);
+    for (int t = 0; t < n; t++) {
+        size_t take = 0;
+        if (total != SIZE_MAX && offsets[t] < total) {
+            take = (t + 1 < n ? offsets[t + 1] : total) - offsets[t];
+            if (take > 0) memcpy(*arr + offsets[t], chunks[t].items, take * sizeof(char *));
+        }
+        for (size_t j = take; j < chunks[t].count; j++) free(((char **)chunks[t].items)[j]); // Tidak terpakai
+        free(chunks[t].items);
+    }
+    if (data) munmap((void *)data, size);
+    if (total == SIZE_MAX) {
+        perror("Gagal alokasi memori untuk string kata");
+        free(*arr);
+        *arr = NULL;
+        *count = 0;
+        return 0;
+    }
+
+    *count = total;
+    if (total < max_to_read) {
+        fprintf(stderr, "Warning: Hanya bisa membaca %zu kata dari %s (diminta %zu)\n", total, filename, max_to_read);
+        char **temp = realloc(*arr, (total ? total : 1) * sizeof(char *));
+        if (temp) *arr = temp;
+    }
+    return 1;
+#else
+    (void)num_threads;
+    return read_words(filename, arr, count, max_to_read);
+#endif
+}
+
+// free_words tetap sama
+void free_words(char **arr, size_t count) {
+    if (!arr) return;
+    for (size_t i = 0; i < count; i++) {
+        if (arr[i]) free(arr[i]); // Tambahkan check null untuk keamanan
+    }
+    free(arr);
+}
+
+#endif // DATA_LOADER_H
@@ -4,19 +4,20 @@
 #include <string.h>
 
 // Fungsi untuk membangkitkan angka acak dan menyimpannya ke file
-void generate_random_numbers(const char *filename, int count, int max_value) {
+void generate_random_numbers(const char *filename, size_t count, int max_value) {
     FILE *fp = fopen(filename, "w");
     if (!fp) {
         perror("Error membuka file untuk angka");
         return;
     }
 
-    srand(time(NULL)); // Inisialisasi seed HANYA SEKALI di awal program jika dipanggil berurutan
-    printf("Memulai generate %d angka acak ke %s...\n", count, filename);
-    for (int i = 0; i < count; i++) {
+    // Seed diinisialisasi SEKALI di main() agar dataset bisa direproduksi dari seed yang dicatat
+    printf("Memulai generate %zu angka acak ke %s...\n", count, filename);
+    size_t progress_step = count / 10 ? count / 10 : 1; // Hindari modulo nol untuk count < 10
+    for (size_t i = 0; i < count; i++) {
         int num = rand() % (max_value + 1); // Menghasilkan angka dari 0 hingga max_value
         fprintf(fp, "%d\n", num);
-        if ((i + 1) % (count / 10) == 0) { // Progress update
+        if ((i + 1) % progress_step == 0) { // Progress update
              printf("... %d%% selesai\n", (int)(((double)(i + 1) / count) * 100));
         }
     }
@@ -36,7 +37,7 @@ void random_word(char *word, int length) {
 }
 
 // Fungsi untuk membangkitkan kata acak dan menyimpannya ke file
-void generate_random_words(const char *filename, int count, int max_word_length) {
+void generate_random_words(const char *filename, size_t count, int max_word_length) {
     FILE *fp = fopen(filename, "w");
     if (!fp) {
         perror("Error membuka file untuk kata");
@@ -47,7 +48,7 @@ void generate_random_words(const char *filename, int count, int max_word_length)
     // srand(time(NULL)); // Seed sudah diinisialisasi di generate_random_numbers jika dipanggil sebelumnya
                              // Jika file ini dijalankan terpisah, uncomment srand() di sini.
 
-    printf("Memulai generate %d kata acak ke %s (max length %d)...\n", count, filename, max_word_length);
+    printf("Memulai generate %zu kata acak ke %s (max length %d)...\n", count, filename, max_word_length);
     int min_word_length = 3; // Set panjang kata minimum
     char *word_buffer = (char *)malloc(max_word_length + 1); // Alokasi buffer kata
     if (!word_buffer) {
@@ -57,11 +58,12 @@ void generate_random_words(const char *filename, int count, int max_word_length)
     }
 
 
-    for (int i = 0; i < count; i++) {
+    size_t progress_step = count / 10 ? count / 10 : 1;
+    for (size_t i = 0; i < count; i++) {
         int length = min_word_length + rand() % (max_word_length - min_word_length + 1);
         random_word(word_buffer, length);
         fprintf(fp, "%s\n", word_buffer);
-         if ((i + 1) % (count / 10) == 0) { // Progress update
+         if ((i + 1) % progress_step == 0) { // Progress update
              printf("... %d%% selesai\n", (int)(((double)(i + 1) / count) * 100));
         }
     }
@@ -71,19 +73,76 @@ void generate_random_words(const char *filename, int count, int max_word_length)
     printf("Generate kata selesai.\n");
 }
 
-int main() {
-    int num_count = 2000000; // Jumlah data: 2 Juta
+// Fungsi untuk membangkitkan kata dengan banyak duplikat: setiap baris diambil
+// secara acak dari kosakata berisi vocab_size kata acak
+void generate_vocabulary_words(const char *filename, size_t count, int vocab_size, int max_word_length) {
+    FILE *fp = fopen(filename, "w");
+    if (!fp) {
+        perror("Error membuka file untuk kata duplikat");
+        return;
+    }
+
+    printf("Memulai generate %zu kata dari %d kosakata ke %s...\n", count, vocab_size, filename);
+    int min_word_length = 3;
+    char *vocab = (char *)malloc((size_t)vocab_size * (max_word_length + 1)); // Kosakata rata dalam satu blok
+    if (!vocab) {
+        perror("Gagal alokasi memori untuk kosakata");
+        fclose(fp);
+        return;
+    }
+    for (int v = 0; v < vocab_size; v++) {
+        int length = min_word_length + rand() % (max_word_length - min_word_length + 1);
+        random_word(vocab + (size_t)v * (max_word_length + 1), length);
+    }
+
+    size_t progress_step = count / 10 ? count / 10 : 1;
+    for (size_t i = 0; i < count; i++) {
+        fprintf(fp, "%s\n", vocab + (size_t)(rand() % vocab_size) * (max_word_length + 1));
+        if ((i + 1) % progress_step == 0) { // Progress update
+             printf("... %d%% selesai\n", (int)(((double)(i + 1) / count) * 100));
+        }
+    }
+
+    free(vocab);
+    fclose(fp);
+    printf("Generate kata duplikat selesai.\n");
+}
+
+// Mencatat seed dan distribusi dataset agar hasil benchmark bisa dilacak ke datanya
+void write_data_meta(const char *filename, unsigned int seed, size_t count, int max_value, int max_word_length, int vocab_size) {
+    FILE *fp = fopen(filename, "w");
+    if (!fp) {
+        perror("Error membuka file metadata data");
+        return;
+    }
+    fprintf(fp, "seed=%u\n", seed);
+    fprintf(fp, "count=%zu\n", count);
+    fprintf(fp, "distribution=angka uniform [0,%d]; kata uniform a-z panjang 3-%d; kata duplikat %d kosakata\n",
+            max_value, max_word_length, vocab_size);
+    fclose(fp);
+}
+
+int main(int argc, char *argv[]) {
+    size_t num_count = 2000000; // Jumlah data: 2 Juta
     int max_value = 2000000; // Nilai angka maksimum
     int max_word_len = 15;   // Panjang kata maksimum
+    int vocab_size = 1000;   // Jumlah kata unik di data_kata_dup.txt
+
+    // Seed bisa diberikan sebagai argumen pertama agar dataset dapat direproduksi
+    unsigned int seed = (argc > 1) ? (unsigned int)strtoul(argv[1], NULL, 10) : (unsigned int)time(NULL);
 
     // Menggunakan srand() sekali di awal main direkomendasikan
-    srand(time(NULL));
+    srand(seed);
 
-    printf("--- GENERATE DATA UJI ---\n");
+    printf("--- GENERATE DATA UJI (seed %u) ---\n", seed);
 
     generate_random_numbers("data_angka.txt", num_count, max_value);
     printf("\n");
     generate_random_words("data_kata.txt", num_count, max_word_len);
+    printf("\n");
+    generate_vocabulary_words("data_kata_dup.txt", num_count, vocab_size, max_word_len);
+
+    write_data_meta("data_meta.txt", seed, num_count, max_value, max_word_len, vocab_size);
 
     printf("\n--- Selesai Generate Data ---\n");
 
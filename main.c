@@ -1,12 +1,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h> // Untuk UINT32_MAX
 #include <time.h> // Untuk clock()
 
 // --- Platform Specific Includes for Memory Usage ---
 #if defined(__linux__) || defined(__APPLE__)
 #include <sys/time.h>
 #include <sys/resource.h>
+#include <unistd.h> // sysconf(_SC_PAGESIZE) untuk RSS saat ini
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #include <psapi.h>
@@ -16,147 +18,78 @@
 // ----------------------------------------------------
 
 #include "sorting_algorithms.h" // Sertakan header algoritma sorting kita
+#include "sort_dispatch.h" // Kernel per ISA yang dipilih saat startup
+#include "sort_auto.h" // sort_auto_int/sort_auto_str: pilih algoritma dari sampel input
+#include "benchmark_results.h" // Penyimpanan hasil & mode perbandingan baseline
+#include "data_loader.h" // read_numbers(_parallel), read_words(_parallel), free_words
+#include "buffer_pool.h" // Arena selaras & pre-faulted untuk salinan data dan scratch
 
-#define DATA_ANGKA_FILE "data_angka.txt"
-#define DATA_KATA_FILE "data_kata.txt"
 // NUM_ELEMENTS sekarang menjadi batas atas, bukan ukuran tetap untuk dibaca
 #define MAX_EXPECTED_ELEMENTS 2000000
 #define MAX_WORD_LENGTH 20
-#define MAX_LINE_LENGTH 25
+#define RECORD_PAYLOAD_SIZE 60 // Record benchmark: 4 byte key + 60 byte payload = 64 byte
 
-// === Fungsi Helper untuk Baca Data (DIMODIFIKASI) ===
-
-/**
- * @brief Membaca maksimal 'max_to_read' angka integer dari file.
- * @param filename Nama file.
- * @param arr Pointer ke pointer array (output).
- * @param count Pointer ke integer (output: jumlah angka yang benar-benar dibaca).
- * @param max_to_read Jumlah maksimum angka yang akan dibaca.
- * @return 1 jika berhasil membuka file & alokasi awal, 0 jika gagal.
- */
-int read_numbers(const char *filename, int **arr, int *count, int max_to_read) {
-    FILE *fp = fopen(filename, "r");
-    if (!fp) {
-        perror("Error membuka file angka");
-        *arr = NULL;
-        *count = 0;
-        return 0;
-    }
-
-    // Alokasi sesuai jumlah yang diminta
-    *arr = (int *)malloc(max_to_read * sizeof(int));
-    if (!*arr) {
-        perror("Gagal alokasi memori untuk array angka");
-        fclose(fp);
-        *count = 0;
-        return 0; // Gagal alokasi
-    }
-
-    int i = 0;
-    // Baca hingga max_to_read tercapai atau EOF
-    while (i < max_to_read && fscanf(fp, "%d", &(*arr)[i]) == 1) {
-        i++;
-    }
-
-    *count = i; // Jumlah angka yang berhasil dibaca
-
-    // Jika file lebih kecil dari yang diminta, resize (opsional tapi baik)
-    if (i < max_to_read) {
-         fprintf(stderr, "Warning: Hanya bisa membaca %d angka dari %s (diminta %d)\n", i, filename, max_to_read);
-         int *temp = realloc(*arr, i * sizeof(int));
-         if (temp) {
-             *arr = temp;
-         } else {
-             // Jika realloc gagal, data lama masih valid tapi ukurannya tidak optimal
-             fprintf(stderr, "Warning: Gagal realloc untuk memperkecil array angka.\n");
-         }
-    }
-
-    fclose(fp);
-    return 1; // Berhasil (setidaknya membuka file dan alokasi awal)
-}
+// === Fungsi Helper untuk Pengukuran (TETAP SAMA) ===
 
-/**
- * @brief Membaca maksimal 'max_to_read' kata dari file.
- * @param filename Nama file.
- * @param arr Pointer ke pointer array string (output).
- * @param count Pointer ke integer (output: jumlah kata yang benar-benar dibaca).
- * @param max_to_read Jumlah maksimum kata yang akan dibaca.
- * @return 1 jika berhasil membuka file & alokasi awal, 0 jika gagal.
- */
-int read_words(const char *filename, char ***arr, int *count, int max_to_read) {
-    FILE *fp = fopen(filename, "r");
-    if (!fp) {
-        perror("Error membuka file kata");
-        *arr = NULL;
-        *count = 0;
-        return 0;
-    }
+typedef struct {
+    double time_sec;   // Rata-rata waktu dari semua pengulangan
+    double stddev_sec; // Simpangan baku waktu (0 jika hanya 1 pengulangan)
+    long memory_kb;    // Kenaikan RSS puncak terbesar di atas baseline dari semua pengulangan
+    long scratch_kb;   // Scratch pool yang dipesan untuk algoritma ini (0 = tidak memakai)
+} PerformanceResult;
 
-    // Alokasi array pointer char* sesuai jumlah yang diminta
-    *arr = (char **)malloc(max_to_read * sizeof(char *));
-    if (!*arr) {
-        perror("Gagal alokasi memori untuk array pointer kata");
-        fclose(fp);
-        *count = 0;
-        return 0;
-    }
+// === Konfigurasi Benchmark (diisi dari argumen command line) ===
 
-    char line_buffer[MAX_LINE_LENGTH];
-    int i = 0;
-    while (i < max_to_read && fgets(line_buffer, sizeof(line_buffer), fp)) {
-        line_buffer[strcspn(line_buffer, "\r\n")] = 0; // Hapus newline
-
-        // Alokasi memori untuk string aktual dan salin
-        (*arr)[i] = (char *)malloc((strlen(line_buffer) + 1) * sizeof(char));
-        if (!(*arr)[i]) {
-            perror("Gagal alokasi memori untuk string kata");
-            // Cleanup memori yang sudah dialokasi dalam loop ini
-            for (int j = 0; j < i; j++) { free((*arr)[j]); }
-            free(*arr);
-            *arr = NULL;
-            *count = 0;
-            fclose(fp);
-            return 0; // Gagal alokasi string
-        }
-        strcpy((*arr)[i], line_buffer);
-        i++;
-    }
+typedef struct {
+    int repeat;               // Jumlah pengulangan per algoritma (untuk statistik)
+    size_t max_size;          // Lewati ukuran data di atas batas ini (0 = tanpa batas)
+    const char *results_file; // File hasil (append), NULL = tidak disimpan
+    const char *compare_file; // File baseline untuk mode perbandingan, NULL = nonaktif
+    BenchCompareOptions compare; // Ambang relatif, alpha uji t, durasi & selisih minimum
+    const char *isa;          // Paksa level ISA kernel (NULL = deteksi otomatis)
+    const char *auto_table;   // Ubah tabel keputusan sort_auto (NULL = env SORT_AUTO_TABLE)
+    int wordcount;            // 1 = jalankan benchmark hitung kata unik, bukan suite sorting
+    int incremental;          // 1 = jalankan benchmark sorting inkremental, bukan suite sorting
+    int use_pool;             // 0 = malloc per pengujian seperti semula (--no-pool)
+    const char *pages;        // Jenis halaman buffer pool: normal|thp|hugetlb
+    int loader_threads;       // Thread loader data (0 = jumlah core, 1 = sekuensial)
+    BenchResultList results;  // Semua hasil run ini
+} BenchConfig;
 
-    *count = i; // Jumlah kata yang berhasil dibaca
+BenchConfig bench_config = {
+    .repeat = 1,
+    .compare = {.time_threshold = 0.05, .mem_threshold = 0.10, .alpha = 0.01,
+                .min_time_sec = 0.005, .min_delta_sec = 0.001},
+    .use_pool = 1,
+    .pages = "thp",
+};
 
-     // Jika file lebih kecil dari yang diminta, resize array pointer
-     if (i < max_to_read) {
-         fprintf(stderr, "Warning: Hanya bisa membaca %d kata dari %s (diminta %d)\n", i, filename, max_to_read);
-         char **temp = realloc(*arr, i * sizeof(char *));
-         if (temp) {
-             *arr = temp;
-         } else {
-              fprintf(stderr, "Warning: Gagal realloc untuk memperkecil array pointer kata.\n");
-              // Data lama masih valid, tapi memori tidak optimal
-         }
-     }
+// Arena salinan data & scratch; dialokasikan sekali untuk ukuran terbesar
+BufferPool bench_pool;
 
-    fclose(fp);
-    return 1; // Berhasil
+// Menyimpan hasil satu algoritma ke bench_config.results (hanya jika dibutuhkan)
+void record_bench_result(const char *algo_name, const char *data_type, size_t count, const PerformanceResult *result) {
+    if (!bench_config.results_file && !bench_config.compare_file) return;
+    BenchResult r;
+    memset(&r, 0, sizeof(r));
+    bench_copy_field(r.algo, sizeof(r.algo), algo_name);
+    bench_copy_field(r.data_type, sizeof(r.data_type), data_type);
+    r.size = count;
+    r.reps = bench_config.repeat;
+    r.mean_sec = result->time_sec;
+    r.stddev_sec = result->stddev_sec;
+    r.memory_kb = result->memory_kb;
+    bench_list_add(&bench_config.results, &r);
 }
 
-// free_words tetap sama
-void free_words(char **arr, int count) {
-    if (!arr) return;
-    for (int i = 0; i < count; i++) {
-        if (arr[i]) free(arr[i]); // Tambahkan check null untuk keamanan
-    }
-    free(arr);
+// Menggabungkan satu pengukuran ke rata-rata/simpangan berjalan (algoritma Welford)
+void accumulate_time(PerformanceResult *result, double *m2, int rep, double time_sec) {
+    double delta = time_sec - result->time_sec;
+    result->time_sec += delta / (rep + 1);
+    *m2 += delta * (time_sec - result->time_sec);
+    result->stddev_sec = rep > 0 ? sqrt(*m2 / rep) : 0.0;
 }
 
-// === Fungsi Helper untuk Pengukuran (TETAP SAMA) ===
-
-typedef struct {
-    double time_sec;
-    long memory_kb;
-} PerformanceResult;
-
 long get_peak_memory_usage_kb() {
 #if defined(__linux__) || defined(__APPLE__)
     struct rusage usage;
@@ -180,20 +113,156 @@ long get_peak_memory_usage_kb() {
 #endif
 }
 
+/**
+ * @brief Mereset penanda memori puncak proses agar pengukuran berikutnya hanya
+ *        mencerminkan satu algoritma.
+ * @prinsip ru_maxrss hanya bisa naik, sehingga tanpa reset algoritma yang
+ *          diuji belakangan selalu mewarisi puncak algoritma sebelumnya. Di Linux
+ *          menulis "5" ke /proc/self/clear_refs mereset high-water mark RSS.
+ *          Di platform lain fungsi ini tidak melakukan apa-apa.
+ */
+void reset_peak_memory_usage() {
+#if defined(__linux__)
+    FILE *fp = fopen("/proc/self/clear_refs", "w");
+    if (fp) {
+        fputs("5", fp);
+        fclose(fp);
+    }
+#endif
+}
+
+// RSS proses saat ini dalam KB (Linux, /proc/self/statm); -1 jika tidak tersedia
+long get_current_memory_usage_kb() {
+#if defined(__linux__)
+    long size = 0, resident = -1;
+    FILE *fp = fopen("/proc/self/statm", "r");
+    if (!fp) return -1;
+    if (fscanf(fp, "%ld %ld", &size, &resident) != 2) resident = -1;
+    fclose(fp);
+    return resident < 0 ? -1 : resident * (sysconf(_SC_PAGESIZE) / 1024);
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief Memulai pengukuran memori satu pengulangan: reset puncak, lalu catat
+ *        RSS saat ini sebagai baseline.
+ * @prinsip Baseline sudah mencakup data input, salinan data, dan arena buffer
+ *          pool yang di-prefault, sehingga selisih puncak terhadap baseline
+ *          hanya memori yang disentuh algoritma itu sendiri. Di platform yang
+ *          puncaknya tidak bisa direset, baseline 0 (puncak absolut).
+ * @return RSS baseline dalam KB.
+ */
+long begin_memory_measurement() {
+    reset_peak_memory_usage();
+    long baseline = get_current_memory_usage_kb();
+    return baseline > 0 ? baseline : 0;
+}
+
+// Kenaikan RSS puncak di atas baseline dari begin_memory_measurement (-1 jika tidak didukung)
+long end_memory_measurement(long baseline_kb) {
+    long peak = get_peak_memory_usage_kb();
+    if (peak < 0) return -1;
+    return peak > baseline_kb ? peak - baseline_kb : 0;
+}
+
+// Mencetak waktu (dan simpangan baku jika ada pengulangan), memori puncak, serta scratch pool
+void print_performance_result(const PerformanceResult *result) {
+    printf("Waktu: %8.4f s | ", result->time_sec);
+    if (bench_config.repeat > 1) {
+        printf("SD: %7.4f s | ", result->stddev_sec);
+    }
+    if (result->memory_kb != -1) {
+        #if defined(_WIN32) || defined(_WIN64)
+        printf("Mem Peak WS: %7ld KB", result->memory_kb);
+        #elif defined(__linux__)
+        printf("Mem +RSS: %7ld KB", result->memory_kb);
+        #else
+        printf("Mem Peak RSS: %7ld KB", result->memory_kb);
+        #endif
+    } else {
+        printf("Mem Peak: (N/A)");
+    }
+    if (result->scratch_kb > 0) {
+        printf(" | Scratch pool: %6ld KB", result->scratch_kb);
+    }
+    printf("\n");
+}
+
+// === Buffer Pool Benchmark ===
+
+/**
+ * @brief Mengambil buffer untuk satu pengujian dari pool (atau malloc jika
+ *        pool dimatikan dengan --no-pool).
+ * @prinsip Buffer dari pool sudah terpetakan (pre-faulted), sehingga region
+ *          yang diukur tidak lagi menanggung page fault & zeroing halaman baru.
+ */
+void *bench_buffer_acquire(BufferSlot slot, size_t bytes) {
+    if (!bench_config.use_pool) return malloc(bytes ? bytes : 1);
+    return buffer_pool_reserve(&bench_pool, slot, bytes);
+}
+
+// Pasangan bench_buffer_acquire: hanya membebaskan buffer hasil malloc
+void bench_buffer_release(void *buffer) {
+    if (!bench_config.use_pool) free(buffer);
+}
+
+/**
+ * @brief Memesan scratch pool untuk satu pengujian (di luar region yang diukur).
+ * @prinsip Hanya dipanggil untuk algoritma yang memang memakai scratch, sehingga
+ *          algoritma lain tidak membawa arena yang tidak pernah disentuhnya.
+ * @return Ukuran yang dipesan dalam KB (0 jika pool mati), -1 jika gagal.
+ */
+long bench_scratch_reserve(size_t bytes) {
+    if (!bench_config.use_pool) return 0;
+    if (!buffer_pool_reserve(&bench_pool, BUFFER_SLOT_SCRATCH, bytes)) return -1;
+    return (long)((bytes + 1023) / 1024);
+}
+
+// Scratch pool dalam satuan elemen berukuran elem_size (NULL/0 jika pool mati)
+void *bench_scratch(size_t elem_size, size_t *len) {
+    size_t bytes = 0;
+    void *scratch = bench_config.use_pool ? buffer_pool_slot(&bench_pool, BUFFER_SLOT_SCRATCH, &bytes) : NULL;
+    *len = bytes / elem_size;
+    return scratch;
+}
+
+// Merge Sort yang memakai scratch pool sebagai temp (fallback malloc jika kurang)
+void merge_sort_int_pooled(int arr[], size_t n) {
+    size_t len;
+    int *scratch = (int *)bench_scratch(sizeof(int), &len);
+    merge_sort_int_with_scratch(arr, n, scratch, len);
+}
+
+void merge_sort_str_pooled(char *arr[], size_t n) {
+    size_t len;
+    char **scratch = (char **)bench_scratch(sizeof(char *), &len);
+    merge_sort_str_with_scratch(arr, n, scratch, len);
+}
+
+void merge_sort_int_dispatch_pooled(int arr[], size_t n) {
+    size_t len;
+    int *scratch = (int *)bench_scratch(sizeof(int), &len);
+    merge_sort_int_dispatch_with_scratch(arr, n, scratch, len);
+}
+
 // === Fungsi Utama Pengujian (TETAP SAMA, tapi dipanggil dengan data berbeda) ===
 
 void run_test(
     const char *algo_name,
-    void (*sort_func_int)(int[], int),
-    void (*sort_func_str)(char*[], int),
+    void (*sort_func_int)(int[], size_t),
+    void (*sort_func_str)(char*[], size_t),
     int *data_int, // Ubah nama parameter agar lebih jelas ini data *untuk tes ini*
     char **data_str, // Ubah nama parameter
-    int count,
-    const char *data_type) // Ukuran data sudah dicetak di main loop luar
+    size_t count,
+    const char *data_type, // Ukuran data sudah dicetak di main loop luar
+    int uses_scratch) // 1 untuk varian *_pooled yang mengambil scratch dari pool
 {
-    PerformanceResult result = {0.0, -1};
+    PerformanceResult result = {0.0, 0.0, -1, 0};
     clock_t start_time, end_time;
-    long mem_before = -1, mem_after = -1;
+    long mem_after = -1, mem_base;
+    double m2 = 0.0;
 
     // Mencetak info di sini di-redundant karena sudah ada di loop utama,
     // tapi bisa berguna jika fungsi ini dipanggil dari tempat lain.
@@ -201,46 +270,59 @@ void run_test(
     // printf("--------------------------------------------------\n");
     // printf("Menguji Algoritma : %s\n", algo_name);
     // printf("Tipe Data         : %s\n", data_type);
-    // printf("Jumlah Data       : %d\n", count); // INFO INI SUDAH ADA DI LUAR
+    // printf("Jumlah Data       : %zu\n", count); // INFO INI SUDAH ADA DI LUAR
 
     printf("  -> Algoritma: %-15s ... ", algo_name); // Format lebih ringkas
     fflush(stdout); // Pastikan output muncul sebelum proses sorting lama
 
+    // Scratch untuk varian *_pooled disiapkan di luar region yang diukur
+    if (uses_scratch) {
+        result.scratch_kb = bench_scratch_reserve((count / 2 + 1) * (sort_func_int ? sizeof(int) : sizeof(char *)));
+        if (result.scratch_kb < 0) { printf(" GAGAL.\n"); return; }
+    }
+
     if (strcmp(data_type, "Angka") == 0 && sort_func_int != NULL) {
         // 1. BUAT SALINAN dari data_int (subset yg sudah dibaca)
-        int *data_copy = (int *)malloc(count * sizeof(int));
+        int *data_copy = (int *)bench_buffer_acquire(BUFFER_SLOT_DATA, count * sizeof(int));
         if (!data_copy) {
             perror(" Gagal alokasi memori salinan angka"); printf(" GAGAL.\n"); return;
         }
-        memcpy(data_copy, data_int, count * sizeof(int));
 
-        mem_before = get_peak_memory_usage_kb();
-        start_time = clock();
-        sort_func_int(data_copy, count);
-        end_time = clock();
-        mem_after = get_peak_memory_usage_kb();
+        for (int rep = 0; rep < bench_config.repeat; rep++) {
+            // Salin ulang setiap pengulangan agar input selalu belum terurut
+            memcpy(data_copy, data_int, count * sizeof(int));
+
+            mem_base = begin_memory_measurement();
+            start_time = clock();
+            sort_func_int(data_copy, count);
+            end_time = clock();
+            mem_after = end_memory_measurement(mem_base);
 
-        result.time_sec = ((double)(end_time - start_time)) / CLOCKS_PER_SEC;
-        if (mem_after != -1) { result.memory_kb = mem_after; }
-        free(data_copy);
+            accumulate_time(&result, &m2, rep, ((double)(end_time - start_time)) / CLOCKS_PER_SEC);
+            if (mem_after > result.memory_kb) { result.memory_kb = mem_after; }
+        }
+        bench_buffer_release(data_copy);
 
     } else if (strcmp(data_type, "Kata") == 0 && sort_func_str != NULL) {
         // 1. BUAT SALINAN array pointer dari data_str
-        char **data_copy = (char **)malloc(count * sizeof(char *));
+        char **data_copy = (char **)bench_buffer_acquire(BUFFER_SLOT_DATA, count * sizeof(char *));
          if (!data_copy) {
             perror(" Gagal alokasi memori salinan kata (pointer)"); printf(" GAGAL.\n"); return;
         }
-        memcpy(data_copy, data_str, count * sizeof(char *)); // Shallow copy
 
-        mem_before = get_peak_memory_usage_kb();
-        start_time = clock();
-        sort_func_str(data_copy, count);
-        end_time = clock();
-        mem_after = get_peak_memory_usage_kb();
+        for (int rep = 0; rep < bench_config.repeat; rep++) {
+            memcpy(data_copy, data_str, count * sizeof(char *)); // Shallow copy
 
-        result.time_sec = ((double)(end_time - start_time)) / CLOCKS_PER_SEC;
-        if (mem_after != -1) { result.memory_kb = mem_after; }
-        free(data_copy); // Free array pointer salinan
+            mem_base = begin_memory_measurement();
+            start_time = clock();
+            sort_func_str(data_copy, count);
+            end_time = clock();
+            mem_after = end_memory_measurement(mem_base);
+
+            accumulate_time(&result, &m2, rep, ((double)(end_time - start_time)) / CLOCKS_PER_SEC);
+            if (mem_after > result.memory_kb) { result.memory_kb = mem_after; }
+        }
+        bench_buffer_release(data_copy); // Free array pointer salinan (jika bukan dari pool)
 
     } else {
         printf(" Tipe data/fungsi tidak valid. GAGAL.\n");
@@ -248,23 +330,472 @@ void run_test(
     }
 
     // Cetak hasil ringkas
-    printf("Waktu: %8.4f s | ", result.time_sec);
-    if (result.memory_kb != -1) {
-        #if defined(_WIN32) || defined(_WIN64)
-        printf("Mem Peak WS: %7ld KB\n", result.memory_kb);
-        #else
-        printf("Mem Peak RSS: %7ld KB\n", result.memory_kb);
-        #endif
+    print_performance_result(&result);
+    record_bench_result(algo_name, data_type, count, &result);
+    // printf("--------------------------------------------------\n"); // Hapus garis bawah per algoritma
+}
+
+// Mencetak keputusan sort_auto terakhir di bawah baris hasil "Sort Auto"
+void print_sort_auto_decision(const char *func) {
+    printf("     keputusan: ");
+    sort_auto_print_decision(stdout, func, &sort_auto_last);
+}
+
+// === Benchmark Record: Sort Langsung vs Key-Payload + Gather ===
+
+typedef struct {
+    int key;
+    char payload[RECORD_PAYLOAD_SIZE];
+} BenchRecord;
+
+// Record dengan key string (pointer ke kata), ukurannya sama dengan BenchRecord
+typedef struct {
+    char *key;
+    char payload[sizeof(BenchRecord) - sizeof(char *)];
+} BenchStrRecord;
+
+// Sort langsung pada array record (baseline, setiap langkah merge memindah 64 byte).
+// Hanya merge yang dipakai; perbandingan key saja sudah stabil untuk merge.
+#define RECORD_KEY_LESS_EQ(a, b) ((a).key <= (b).key)
+#define STR_RECORD_KEY_LESS_EQ(a, b) (strcmp((a).key, (b).key) <= 0)
+DEFINE_ELEMENT_SORTS(records, BenchRecord, RECORD_KEY_LESS_EQ)
+DEFINE_ELEMENT_SORTS(str_records, BenchStrRecord, STR_RECORD_KEY_LESS_EQ)
+
+// Jalur sort record yang dibandingkan
+typedef enum {
+    RECORD_DIRECT,  // Merge sort langsung pada array record
+    RECORD_PAIRS,   // Pasangan key-payload (uint64_t terkemas / StrKeyIndex) + gather
+    RECORD_ARGSORT  // argsort_int/argsort_str pada array key + apply_permutation
+} RecordPath;
+
+/**
+ * @brief Mengukur sort record berkey int atau berkey string lewat satu jalur.
+ * @prinsip Semua buffer kerja dialokasikan di luar region yang diukur. Jalur
+ *          RECORD_PAIRS dan RECORD_ARGSORT mengukur pembuatan pasangan/array
+ *          key, sort, dan gather record ke `out`, sehingga biayanya sebanding
+ *          dengan sort langsung yang menghasilkan array record terurut.
+ * @param label Nama yang dicetak.
+ * @param path Jalur sort yang diukur.
+ * @param method Algoritma dasar untuk RECORD_PAIRS/RECORD_ARGSORT.
+ * @param records Record berkey int, atau NULL jika memakai str_records.
+ * @param str_records Record berkey string (dipakai jika records NULL).
+ * @param count Jumlah record.
+ */
+void run_record_test(const char *label, RecordPath path, ArgsortMethod method,
+                     const BenchRecord *records, const BenchStrRecord *str_records, size_t count) {
+    PerformanceResult result = {0.0, 0.0, -1, 0};
+    clock_t start_time, end_time;
+    long mem_after, mem_base;
+    double m2 = 0.0;
+    int ok = 1;
+    size_t rec_size = records ? sizeof(BenchRecord) : sizeof(BenchStrRecord);
+    const void *src = records ? (const void *)records : (const void *)str_records;
+    size_t alloc_count = count ? count : 1;
+
+    printf("  -> Algoritma: %-24s ... ", label);
+    fflush(stdout);
+
+    void *out = malloc(alloc_count * rec_size);
+    void *work = NULL;  // DIRECT: temp merge, PAIRS: array pasangan, ARGSORT: array key
+    size_t *idx = NULL; // ARGSORT: permutasi indeks
+    if (path == RECORD_DIRECT) {
+        work = malloc((count / 2 + 1) * rec_size);
+    } else if (path == RECORD_PAIRS) {
+        work = malloc(alloc_count * (records ? sizeof(uint64_t) : sizeof(StrKeyIndex)));
     } else {
-        printf("Mem Peak: (N/A)\n");
+        work = malloc(alloc_count * (records ? sizeof(int) : sizeof(char *)));
+        idx = (size_t *)malloc(alloc_count * sizeof(size_t));
     }
-    // printf("--------------------------------------------------\n"); // Hapus garis bawah per algoritma
+    if (!out || !work || (path == RECORD_ARGSORT && !idx)) {
+        perror(" Gagal alokasi memori benchmark record"); printf(" GAGAL.\n");
+        free(out); free(work); free(idx); return;
+    }
+
+    for (int rep = 0; rep < bench_config.repeat && ok; rep++) {
+        if (path == RECORD_DIRECT) memcpy(out, src, count * rec_size);
+        mem_base = begin_memory_measurement();
+        start_time = clock();
+        if (path == RECORD_DIRECT) {
+            if (count > 1 && records) merge_sort_recursive_records((BenchRecord *)out, 0, count - 1, (BenchRecord *)work);
+            else if (count > 1) merge_sort_recursive_str_records((BenchStrRecord *)out, 0, count - 1, (BenchStrRecord *)work);
+        } else if (path == RECORD_PAIRS && records) {
+            uint64_t *packed = (uint64_t *)work;
+            for (size_t i = 0; i < count; i++)
+                packed[i] = pack_key_index_int(records[i].key, (uint32_t)i);
+            ok = sort_key_index32_int(packed, count, method);
+            if (ok) apply_permutation_packed(records, out, rec_size, packed, count);
+        } else if (path == RECORD_PAIRS) {
+            StrKeyIndex *pairs = (StrKeyIndex *)work;
+            for (size_t i = 0; i < count; i++) {
+                pairs[i].key = str_records[i].key;
+                pairs[i].index = i;
+            }
+            ok = sort_key_index_str(pairs, count, method);
+            for (size_t i = 0; ok && i < count; i++)
+                ((BenchStrRecord *)out)[i] = str_records[pairs[i].index];
+        } else if (records) {
+            int *keys = (int *)work;
+            for (size_t i = 0; i < count; i++) keys[i] = records[i].key;
+            ok = argsort_int(keys, idx, count, method);
+            if (ok) apply_permutation(records, out, rec_size, idx, count);
+        } else {
+            char **keys = (char **)work;
+            for (size_t i = 0; i < count; i++) keys[i] = str_records[i].key;
+            ok = argsort_str(keys, idx, count, method);
+            if (ok) apply_permutation(str_records, out, rec_size, idx, count);
+        }
+        end_time = clock();
+        mem_after = end_memory_measurement(mem_base);
+        accumulate_time(&result, &m2, rep, ((double)(end_time - start_time)) / CLOCKS_PER_SEC);
+        if (mem_after > result.memory_kb) { result.memory_kb = mem_after; }
+    }
+    free(out);
+    free(work);
+    free(idx);
+    if (!ok) { printf(" GAGAL.\n"); return; }
+
+    print_performance_result(&result);
+    record_bench_result(label, records ? "Record" : "RecKata", count, &result);
 }
 
+// === Benchmark Kata Unik + Frekuensi ===
+
+#define WORDCOUNT_SORT_THEN_SCAN 0
+#define WORDCOUNT_FUSED 1
+#define WORDCOUNT_HASH 2
+
+/**
+ * @brief Mengukur satu metode "kata unik + jumlah kemunculan".
+ * @param label Nama yang dicetak.
+ * @param method WORDCOUNT_SORT_THEN_SCAN (merge_sort_str lalu scan),
+ *               WORDCOUNT_FUSED (sort_unique_count_str), atau
+ *               WORDCOUNT_HASH (hash_count_str).
+ * @param words Array kata sumber (tidak diubah).
+ * @param count Jumlah kata.
+ * @param data_type Label tipe data untuk file hasil.
+ */
+void run_wordcount_test(const char *label, int method, char **words, size_t count, const char *data_type) {
+    PerformanceResult result = {0.0, 0.0, -1, 0};
+    clock_t start_time, end_time;
+    long mem_after, mem_base;
+    double m2 = 0.0;
+    size_t unique = 0;
+
+    printf("  -> Metode: %-18s ... ", label);
+    fflush(stdout);
+
+    WordCount *out = (WordCount *)malloc((count ? count : 1) * sizeof(WordCount));
+    char **data_copy = (char **)malloc((count ? count : 1) * sizeof(char *));
+    if (!out || !data_copy) {
+        perror(" Gagal alokasi memori benchmark hitung kata"); printf(" GAGAL.\n");
+        free(out); free(data_copy); return;
+    }
+
+    for (int rep = 0; rep < bench_config.repeat; rep++) {
+        memcpy(data_copy, words, count * sizeof(char *));
+        mem_base = begin_memory_measurement();
+        start_time = clock();
+        if (method == WORDCOUNT_FUSED) {
+            unique = sort_unique_count_str(data_copy, count, out);
+        } else if (method == WORDCOUNT_HASH) {
+            unique = hash_count_str(data_copy, count, out);
+        } else {
+            merge_sort_str(data_copy, count);
+            unique = count_sorted_runs_str(data_copy, count, out);
+        }
+        end_time = clock();
+        mem_after = end_memory_measurement(mem_base);
+        accumulate_time(&result, &m2, rep, ((double)(end_time - start_time)) / CLOCKS_PER_SEC);
+        if (mem_after > result.memory_kb) { result.memory_kb = mem_after; }
+    }
+
+    printf("Unik: %8zu | ", unique);
+    print_performance_result(&result);
+    record_bench_result(label, data_type, count, &result);
+    free(out);
+    free(data_copy);
+}
+
+/**
+ * @brief Menjalankan benchmark hitung kata untuk setiap ukuran pada data kata
+ *        acak (hampir semua unik) dan data kata duplikat (kosakata kecil).
+ */
+void run_wordcount_benchmark(const size_t test_sizes[], size_t num_sizes) {
+    const char *files[] = {DATA_KATA_FILE, DATA_KATA_DUP_FILE};
+    const char *types[] = {"Kata", "KataDup"};
+
+    for (size_t s = 0; s < num_sizes; ++s) {
+        size_t current_size = test_sizes[s];
+        if (bench_config.max_size > 0 && current_size > bench_config.max_size) continue;
+
+        for (int f = 0; f < 2; f++) {
+            char **words = NULL;
+            size_t word_count_read = 0;
+            if (!read_words_parallel(files[f], &words, &word_count_read, current_size, bench_config.loader_threads) || word_count_read != current_size) {
+                fprintf(stderr, "Error: Gagal membaca %zu kata dari %s. Lewati.\n", current_size, files[f]);
+                free_words(words, word_count_read);
+                continue;
+            }
+            printf("\n-- Hitung Kata %s (Ukuran: %zu) --\n", files[f], current_size);
+            run_wordcount_test("Sort lalu Scan", WORDCOUNT_SORT_THEN_SCAN, words, word_count_read, types[f]);
+            run_wordcount_test("Fused Merge Count", WORDCOUNT_FUSED, words, word_count_read, types[f]);
+            run_wordcount_test("Hash Count", WORDCOUNT_HASH, words, word_count_read, types[f]);
+            free_words(words, word_count_read);
+        }
+    }
+}
+
+// === Benchmark Sorting Inkremental ===
+
+#define INCREMENTAL_GALLOP 0
+#define INCREMENTAL_IN_PLACE 1
+#define INCREMENTAL_FULL_RESORT 2
+
+/**
+ * @brief Mengukur satu cara menumbuhkan data terurut dari `prev` ke `size` elemen.
+ * @param label Nama yang dicetak.
+ * @param method INCREMENTAL_GALLOP (sorted_array_append_* dengan scratch >= batch),
+ *               INCREMENTAL_IN_PLACE (tanpa scratch, block merge di tempat), atau
+ *               INCREMENTAL_FULL_RESORT (merge sort ulang seluruh `size` elemen).
+ * @param base_int/base_str Prefix `prev` elemen yang sudah terurut (input tiap pengulangan).
+ * @param numbers/words Data sumber; batch adalah elemen [prev, size).
+ * @param work_int/work_str Array kerja berkapasitas >= size; berisi hasil setelah kembali.
+ */
+void run_incremental_test(const char *label, int method, const int *base_int, char *const *base_str,
+                          const int *numbers, char **words, size_t prev, size_t size,
+                          SortedIntArray *work_int, SortedStrArray *work_str) {
+    PerformanceResult result = {0.0, 0.0, -1, 0};
+    clock_t start_time, end_time;
+    long mem_after, mem_base;
+    double m2 = 0.0;
+    size_t k = size - prev;
+    int ok = 1;
+
+    printf("  -> Metode: %-15s ... ", label);
+    fflush(stdout);
+
+    // Scratch >= batch untuk galloping merge (pool atau malloc), disiapkan di luar pengukuran
+    void *scratch = NULL;
+    size_t scratch_len = 0;
+    size_t elem_size = work_int ? sizeof(int) : sizeof(char *);
+    if (method == INCREMENTAL_GALLOP) {
+        scratch = bench_buffer_acquire(BUFFER_SLOT_SCRATCH, (k ? k : 1) * elem_size);
+        if (!scratch) { printf(" GAGAL.\n"); return; }
+        scratch_len = k;
+        if (bench_config.use_pool) result.scratch_kb = (long)(((k ? k : 1) * elem_size + 1023) / 1024);
+    } else if (method == INCREMENTAL_FULL_RESORT) {
+        // Scratch pool untuk merge_sort_*_pooled
+        result.scratch_kb = bench_scratch_reserve((size / 2 + 1) * elem_size);
+        if (result.scratch_kb < 0) { printf(" GAGAL.\n"); return; }
+    }
+
+    for (int rep = 0; rep < bench_config.repeat && ok; rep++) {
+        if (work_int) {
+            memcpy(work_int->data, method == INCREMENTAL_FULL_RESORT ? numbers : base_int,
+                   (method == INCREMENTAL_FULL_RESORT ? size : prev) * sizeof(int));
+            work_int->count = prev;
+        } else {
+            memcpy(work_str->data, method == INCREMENTAL_FULL_RESORT ? (char *const *)words : base_str,
+                   (method == INCREMENTAL_FULL_RESORT ? size : prev) * sizeof(char *));
+            work_str->count = prev;
+        }
+
+        mem_base = begin_memory_measurement();
+        start_time = clock();
+        if (method == INCREMENTAL_FULL_RESORT) {
+            if (work_int) { merge_sort_int_pooled(work_int->data, size); work_int->count = size; }
+            else { merge_sort_str_pooled(work_str->data, size); work_str->count = size; }
+        } else if (work_int) {
+            ok = sorted_array_append_int(work_int, numbers + prev, k, (int *)scratch, scratch_len);
+        } else {
+            ok = sorted_array_append_str(work_str, words + prev, k, (char **)scratch, scratch_len);
+        }
+        end_time = clock();
+        mem_after = end_memory_measurement(mem_base);
+        accumulate_time(&result, &m2, rep, ((double)(end_time - start_time)) / CLOCKS_PER_SEC);
+        if (mem_after > result.memory_kb) { result.memory_kb = mem_after; }
+    }
+    if (scratch) bench_buffer_release(scratch);
+    if (!ok) { printf(" GAGAL.\n"); return; }
+
+    print_performance_result(&result);
+    record_bench_result(label, work_int ? "Angka" : "Kata", size, &result);
+}
+
+/**
+ * @brief Menumbuhkan data angka dan kata dari ukuran terkecil ke terbesar di
+ *        test_sizes, setiap langkah menambahkan batch [ukuran sebelumnya, ukuran).
+ * @prinsip Setiap langkah dibandingkan: append batch dengan galloping merge,
+ *          append dengan merge di tempat, dan merge sort ulang seluruh data.
+ *          Prefix terurut hasil langkah sebelumnya menjadi input langkah berikutnya.
+ */
+void run_incremental_benchmark(const size_t test_sizes[], size_t num_sizes) {
+    size_t largest = 0;
+    for (size_t s = 0; s < num_sizes; ++s) {
+        if (bench_config.max_size > 0 && test_sizes[s] > bench_config.max_size) continue;
+        if (test_sizes[s] > largest) largest = test_sizes[s];
+    }
+    if (largest == 0) return;
+
+    int *numbers = NULL;
+    char **words = NULL;
+    size_t number_count = 0, word_count = 0;
+    if (!read_numbers_parallel(DATA_ANGKA_FILE, &numbers, &number_count, largest, bench_config.loader_threads) ||
+        !read_words_parallel(DATA_KATA_FILE, &words, &word_count, largest, bench_config.loader_threads) ||
+        number_count != largest || word_count != largest) {
+        fprintf(stderr, "Error: Gagal membaca %zu angka/kata untuk benchmark inkremental.\n", largest);
+        free(numbers);
+        free_words(words, word_count);
+        return;
+    }
+
+    SortedIntArray work_int;
+    SortedStrArray work_str;
+    sorted_array_init_int(&work_int);
+    sorted_array_init_str(&work_str);
+    int *base_int = (int *)malloc(largest * sizeof(int));
+    char **base_str = (char **)malloc(largest * sizeof(char *));
+    work_int.data = (int *)malloc(largest * sizeof(int));
+    work_str.data = (char **)malloc(largest * sizeof(char *));
+    if (!base_int || !base_str || !work_int.data || !work_str.data) {
+        perror("Gagal alokasi memori benchmark inkremental");
+    } else {
+        work_int.capacity = largest;
+        work_str.capacity = largest;
+
+        size_t prev = 0;
+        for (size_t s = 0; s < num_sizes; ++s) {
+            size_t size = test_sizes[s];
+            if (bench_config.max_size > 0 && size > bench_config.max_size) continue;
+
+            printf("\n-- Inkremental Angka: %zu -> %zu (batch %zu) --\n", prev, size, size - prev);
+            run_incremental_test("Incr Gallop", INCREMENTAL_GALLOP, base_int, NULL, numbers, NULL, prev, size, &work_int, NULL);
+            run_incremental_test("Incr In-place", INCREMENTAL_IN_PLACE, base_int, NULL, numbers, NULL, prev, size, &work_int, NULL);
+            run_incremental_test("Full Resort", INCREMENTAL_FULL_RESORT, base_int, NULL, numbers, NULL, prev, size, &work_int, NULL);
+            memcpy(base_int, work_int.data, size * sizeof(int));
+
+            printf("-- Inkremental Kata: %zu -> %zu (batch %zu) --\n", prev, size, size - prev);
+            run_incremental_test("Incr Gallop", INCREMENTAL_GALLOP, NULL, base_str, NULL, words, prev, size, NULL, &work_str);
+            run_incremental_test("Incr In-place", INCREMENTAL_IN_PLACE, NULL, base_str, NULL, words, prev, size, NULL, &work_str);
+            run_incremental_test("Full Resort", INCREMENTAL_FULL_RESORT, NULL, base_str, NULL, words, prev, size, NULL, &work_str);
+            memcpy(base_str, work_str.data, size * sizeof(char *));
+            prev = size;
+        }
+    }
+
+    free(base_int);
+    free(base_str);
+    sorted_array_free_int(&work_int);
+    sorted_array_free_str(&work_str);
+    free(numbers);
+    free_words(words, word_count);
+}
+
+/**
+ * @brief Mencetak cara pemakaian program.
+ */
+void print_usage(const char *program) {
+    printf("Pemakaian: %s [opsi]\n", program);
+    printf("  --repeat N        Ulangi setiap algoritma N kali (rata-rata & simpangan baku)\n");
+    printf("  --max-size N      Hanya uji ukuran data <= N\n");
+    printf("  --results FILE    Tambahkan hasil run ini (dengan metadata) ke FILE\n");
+    printf("  --compare FILE    Bandingkan dengan run terakhir di FILE; exit code 1 jika ada regresi\n");
+    printf("  --threshold PCT   Ambang perlambatan dalam persen (default 5)\n");
+    printf("  --mem-threshold PCT  Ambang kenaikan memori dalam persen (default 10)\n");
+    printf("  --confidence PCT  Tingkat kepercayaan uji t Welch satu sisi (default 99)\n");
+    printf("  --min-time MS     Abaikan baris yang mean-nya di bawah MS milidetik (default 5)\n");
+    printf("  --min-delta MS    Selisih mean minimum untuk regresi dalam milidetik (default 1)\n");
+    printf("  --wordcount       Benchmark kata unik + frekuensi (%s dan %s)\n", DATA_KATA_FILE, DATA_KATA_DUP_FILE);
+    printf("  --incremental     Tumbuhkan data 10k -> 2M per batch (append + merge vs sort ulang)\n");
+    printf("  --isa LEVEL       Paksa kernel scalar|sse4.2|avx2|avx512 (default: deteksi CPU, atau env SORT_ISA)\n");
+    printf("  --auto-table SPEC Ubah tabel sort_auto, mis. small_n=32,inline_max_prefix=10\n");
+    printf("  --pages TYPE      Halaman buffer pool normal|thp|hugetlb (default thp)\n");
+    printf("  --loader-threads N  Thread untuk membaca file data (default: jumlah core, 1 = sekuensial)\n");
+    printf("  --no-pool         Alokasikan salinan data & temp per pengujian (perilaku lama)\n");
+}
+
+/**
+ * @brief Membaca argumen command line ke bench_config.
+ * @return 1 jika valid, 0 jika ada argumen yang tidak dikenal/tidak lengkap.
+ */
+int parse_arguments(int argc, char *argv[]) {
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            return 0;
+        } else if (strcmp(arg, "--wordcount") == 0) {
+            bench_config.wordcount = 1;
+            continue; // Opsi tanpa nilai
+        } else if (strcmp(arg, "--incremental") == 0) {
+            bench_config.incremental = 1;
+            continue;
+        } else if (strcmp(arg, "--no-pool") == 0) {
+            bench_config.use_pool = 0;
+            continue;
+        } else if (!value) {
+            fprintf(stderr, "Error: Opsi %s membutuhkan nilai.\n", arg);
+            return 0;
+        } else if (strcmp(arg, "--repeat") == 0) {
+            bench_config.repeat = atoi(value);
+            if (bench_config.repeat < 1) bench_config.repeat = 1;
+        } else if (strcmp(arg, "--max-size") == 0) {
+            bench_config.max_size = (size_t)strtoull(value, NULL, 10);
+        } else if (strcmp(arg, "--results") == 0) {
+            bench_config.results_file = value;
+        } else if (strcmp(arg, "--compare") == 0) {
+            bench_config.compare_file = value;
+        } else if (strcmp(arg, "--threshold") == 0) {
+            bench_config.compare.time_threshold = atof(value) / 100.0;
+        } else if (strcmp(arg, "--mem-threshold") == 0) {
+            bench_config.compare.mem_threshold = atof(value) / 100.0;
+        } else if (strcmp(arg, "--confidence") == 0) {
+            double confidence = atof(value);
+            if (confidence <= 50.0 || confidence >= 100.0) {
+                fprintf(stderr, "Error: --confidence harus di antara 50 dan 100: %s\n", value);
+                return 0;
+            }
+            bench_config.compare.alpha = 1.0 - confidence / 100.0;
+        } else if (strcmp(arg, "--min-time") == 0) {
+            bench_config.compare.min_time_sec = atof(value) / 1000.0;
+        } else if (strcmp(arg, "--min-delta") == 0) {
+            bench_config.compare.min_delta_sec = atof(value) / 1000.0;
+        } else if (strcmp(arg, "--isa") == 0) {
+            bench_config.isa = value;
+        } else if (strcmp(arg, "--auto-table") == 0) {
+            bench_config.auto_table = value;
+        } else if (strcmp(arg, "--loader-threads") == 0) {
+            bench_config.loader_threads = atoi(value);
+            if (bench_config.loader_threads < 0) bench_config.loader_threads = 0;
+        } else if (strcmp(arg, "--pages") == 0) {
+            if (parse_buffer_pages(value) < 0) {
+                fprintf(stderr, "Error: Jenis halaman tidak dikenal: %s\n", value);
+                return 0;
+            }
+            bench_config.pages = value;
+        } else {
+            fprintf(stderr, "Error: Opsi tidak dikenal: %s\n", arg);
+            return 0;
+        }
+        i++; // Lewati nilai opsi
+    }
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    if (!parse_arguments(argc, argv)) {
+        print_usage(argv[0]);
+        return 2;
+    }
+    if (bench_config.compare_file && bench_config.repeat < 2) {
+        fprintf(stderr, "Warning: --compare tanpa --repeat >= 2 tidak bisa menguji signifikansi; "
+                        "perlambatan tidak akan dihitung sebagai regresi.\n");
+    }
+    sort_dispatch_init(bench_config.isa); // Pilih varian kernel sekali saat startup
+    sort_auto_init(bench_config.auto_table);
 
-int main() {
     // === Definisikan Ukuran Data Uji ===
-    int test_sizes[] = {
+    size_t test_sizes[] = {
         10000,
         50000,
         100000,
@@ -274,85 +805,178 @@ int main() {
         1500000,
         2000000
     };
-    int num_sizes = sizeof(test_sizes) / sizeof(test_sizes[0]);
+    size_t num_sizes = sizeof(test_sizes) / sizeof(test_sizes[0]);
 
     printf("===== ANALISIS PERFORMA ALGORITMA SORTING =====\n");
-    printf("Akan menguji %d ukuran data: 10k, 50k, 100k, 250k, 500k, 1M, 1.5M, 2M\n", num_sizes);
+    printf("Akan menguji %zu ukuran data: 10k, 50k, 100k, 250k, 500k, 1M, 1.5M, 2M\n", num_sizes);
     printf("Sumber data: %s (angka), %s (kata)\n", DATA_ANGKA_FILE, DATA_KATA_FILE);
+    printf("Kernel ISA : %s (terdeteksi: %s)\n", sort_isa_name(sort_kernels.level), sort_isa_name(detect_sort_isa()));
+
+    // --- Siapkan buffer pool sekali untuk ukuran terbesar yang akan diuji ---
+    buffer_pool_init(&bench_pool, (BufferPages)parse_buffer_pages(bench_config.pages));
+    if (bench_config.use_pool) {
+        size_t largest = 0;
+        for (size_t s = 0; s < num_sizes; ++s) {
+            if (bench_config.max_size > 0 && test_sizes[s] > bench_config.max_size) continue;
+            if (test_sizes[s] > largest) largest = test_sizes[s];
+        }
+        // Scratch tidak dipesan di sini: run_test memesannya hanya untuk algoritma yang memakainya
+        if (!buffer_pool_reserve(&bench_pool, BUFFER_SLOT_DATA, largest * sizeof(char *))) {
+            fprintf(stderr, "Warning: Buffer pool gagal dialokasikan, memakai malloc per pengujian\n");
+            buffer_pool_free(&bench_pool);
+            bench_config.use_pool = 0;
+        }
+    }
+    if (bench_config.use_pool) {
+        long huge_kb = buffer_pool_huge_kb();
+        printf("Buffer pool: %s, data %zu KB pre-faulted, scratch dipesan per algoritma",
+               buffer_pages_name(bench_pool.arenas[BUFFER_SLOT_DATA].pages), bench_pool.arenas[BUFFER_SLOT_DATA].size / 1024);
+        if (huge_kb >= 0) printf(" (AnonHugePages: %ld KB)", huge_kb);
+        printf("\n");
+    } else {
+        printf("Buffer pool: nonaktif (malloc per pengujian)\n");
+    }
     printf("=================================================\n\n");
 
+    // === Mode Hitung Kata: menggantikan suite sorting ===
+    if (bench_config.wordcount) {
+        run_wordcount_benchmark(test_sizes, num_sizes);
+        num_sizes = 0; // Lewati loop suite sorting di bawah
+    }
+
+    // === Mode Inkremental: menggantikan suite sorting ===
+    if (bench_config.incremental) {
+        run_incremental_benchmark(test_sizes, num_sizes);
+        num_sizes = 0;
+    }
+
     // === Loop Melalui Setiap Ukuran Data ===
-    for (int s = 0; s < num_sizes; ++s) {
-        int current_size = test_sizes[s];
-        printf("--- Memulai Pengujian untuk Ukuran Data: %d ---\n", current_size);
+    for (size_t s = 0; s < num_sizes; ++s) {
+        size_t current_size = test_sizes[s];
+        if (bench_config.max_size > 0 && current_size > bench_config.max_size) {
+            printf("--- Ukuran Data %zu dilewati (--max-size %zu) ---\n\n", current_size, bench_config.max_size);
+            continue;
+        }
+        printf("--- Memulai Pengujian untuk Ukuran Data: %zu ---\n", current_size);
 
         int *current_numbers = NULL;
         char **current_words = NULL;
-        int number_count_read = 0;
-        int word_count_read = 0;
+        size_t number_count_read = 0;
+        size_t word_count_read = 0;
         int read_num_ok = 0;
         int read_word_ok = 0;
 
         // --- Baca Data Angka untuk Ukuran Saat Ini ---
-        printf("Membaca %d angka dari %s...\n", current_size, DATA_ANGKA_FILE);
-        if (read_numbers(DATA_ANGKA_FILE, &current_numbers, &number_count_read, current_size)) {
+        printf("Membaca %zu angka dari %s...\n", current_size, DATA_ANGKA_FILE);
+        if (read_numbers_parallel(DATA_ANGKA_FILE, &current_numbers, &number_count_read, current_size, bench_config.loader_threads)) {
             if (number_count_read == current_size) {
-                printf("Berhasil membaca %d angka.\n", number_count_read);
+                printf("Berhasil membaca %zu angka.\n", number_count_read);
                 read_num_ok = 1;
             } else {
                 // File sumber tidak cukup besar (seharusnya tidak terjadi jika generate 2M)
-                 fprintf(stderr, "Error: Hanya dapat membaca %d angka, butuh %d. Lewati tes angka untuk ukuran ini.\n", number_count_read, current_size);
+                 fprintf(stderr, "Error: Hanya dapat membaca %zu angka, butuh %zu. Lewati tes angka untuk ukuran ini.\n", number_count_read, current_size);
                  // Tetap bebaskan memori jika sebagian terbaca
                  if(current_numbers) free(current_numbers);
                  current_numbers = NULL;
             }
         } else {
-            fprintf(stderr, "Gagal membaca atau alokasi memori untuk angka ukuran %d.\n", current_size);
+            fprintf(stderr, "Gagal membaca atau alokasi memori untuk angka ukuran %zu.\n", current_size);
         }
 
         // --- Baca Data Kata untuk Ukuran Saat Ini ---
-        printf("Membaca %d kata dari %s...\n", current_size, DATA_KATA_FILE);
-        if (read_words(DATA_KATA_FILE, &current_words, &word_count_read, current_size)) {
+        printf("Membaca %zu kata dari %s...\n", current_size, DATA_KATA_FILE);
+        if (read_words_parallel(DATA_KATA_FILE, &current_words, &word_count_read, current_size, bench_config.loader_threads)) {
              if (word_count_read == current_size) {
-                printf("Berhasil membaca %d kata.\n", word_count_read);
+                printf("Berhasil membaca %zu kata.\n", word_count_read);
                 read_word_ok = 1;
             } else {
-                fprintf(stderr, "Error: Hanya dapat membaca %d kata, butuh %d. Lewati tes kata untuk ukuran ini.\n", word_count_read, current_size);
+                fprintf(stderr, "Error: Hanya dapat membaca %zu kata, butuh %zu. Lewati tes kata untuk ukuran ini.\n", word_count_read, current_size);
                 if(current_words) free_words(current_words, word_count_read); // Hati-hati free jika hanya sebagian
                 current_words = NULL;
             }
         } else {
-             fprintf(stderr, "Gagal membaca atau alokasi memori untuk kata ukuran %d.\n", current_size);
+             fprintf(stderr, "Gagal membaca atau alokasi memori untuk kata ukuran %zu.\n", current_size);
         }
 
         // --- Menjalankan Tes untuk Angka (jika data berhasil dibaca) ---
         if (read_num_ok && current_numbers) {
-            printf("\n-- Tes Angka (Ukuran: %d) --\n", current_size);
-            run_test("Bubble Sort", bubble_sort_int, NULL, current_numbers, NULL, number_count_read, "Angka");
-            run_test("Selection Sort", selection_sort_int, NULL, current_numbers, NULL, number_count_read, "Angka");
-            run_test("Insertion Sort", insertion_sort_int, NULL, current_numbers, NULL, number_count_read, "Angka");
-            run_test("Shell Sort", shell_sort_int, NULL, current_numbers, NULL, number_count_read, "Angka");
-            run_test("Merge Sort", merge_sort_int, NULL, current_numbers, NULL, number_count_read, "Angka");
-            run_test("Quick Sort", quick_sort_int, NULL, current_numbers, NULL, number_count_read, "Angka");
+            printf("\n-- Tes Angka (Ukuran: %zu) --\n", current_size);
+            run_test("Bubble Sort", bubble_sort_int, NULL, current_numbers, NULL, number_count_read, "Angka", 0);
+            run_test("Selection Sort", selection_sort_int, NULL, current_numbers, NULL, number_count_read, "Angka", 0);
+            run_test("Insertion Sort", insertion_sort_int, NULL, current_numbers, NULL, number_count_read, "Angka", 0);
+            run_test("Shell Sort", shell_sort_int, NULL, current_numbers, NULL, number_count_read, "Angka", 0);
+            run_test("Merge Sort", merge_sort_int_pooled, NULL, current_numbers, NULL, number_count_read, "Angka", 1);
+            run_test("Block Merge", block_merge_sort_int, NULL, current_numbers, NULL, number_count_read, "Angka", 0);
+            run_test("Quick Sort", quick_sort_int, NULL, current_numbers, NULL, number_count_read, "Angka", 0);
+            run_test("Quick Dispatch", quick_sort_int_dispatch, NULL, current_numbers, NULL, number_count_read, "Angka", 0);
+            run_test("Merge Dispatch", merge_sort_int_dispatch_pooled, NULL, current_numbers, NULL, number_count_read, "Angka", 1);
+            run_test("Sort Auto", sort_auto_int, NULL, current_numbers, NULL, number_count_read, "Angka", 0);
+            print_sort_auto_decision("sort_auto_int");
         } else {
-            printf("\n-- Tes Angka (Ukuran: %d) DILAWATI --\n", current_size);
+            printf("\n-- Tes Angka (Ukuran: %zu) DILAWATI --\n", current_size);
+        }
+
+        // --- Tes Record: key = angka, payload 60 byte (sort langsung vs key-payload + gather) ---
+        if (read_num_ok && current_numbers && number_count_read <= UINT32_MAX) {
+            BenchRecord *records = (BenchRecord *)malloc(number_count_read * sizeof(BenchRecord));
+            if (records) {
+                for (size_t i = 0; i < number_count_read; i++) {
+                    records[i].key = current_numbers[i];
+                    memset(records[i].payload, (int)(i & 0xFF), RECORD_PAYLOAD_SIZE);
+                }
+                printf("\n-- Tes Record %zu byte (Ukuran: %zu) --\n", sizeof(BenchRecord), current_size);
+                run_record_test("Merge Sort (langsung)", RECORD_DIRECT, ARGSORT_MERGE, records, NULL, number_count_read);
+                run_record_test("Merge Sort (key-payload)", RECORD_PAIRS, ARGSORT_MERGE, records, NULL, number_count_read);
+                run_record_test("Quick Sort (key-payload)", RECORD_PAIRS, ARGSORT_QUICK, records, NULL, number_count_read);
+                run_record_test("Shell Sort (key-payload)", RECORD_PAIRS, ARGSORT_SHELL, records, NULL, number_count_read);
+                run_record_test("Merge Sort (argsort)", RECORD_ARGSORT, ARGSORT_MERGE, records, NULL, number_count_read);
+                run_record_test("Quick Sort (argsort)", RECORD_ARGSORT, ARGSORT_QUICK, records, NULL, number_count_read);
+                free(records);
+            } else {
+                perror("Gagal alokasi memori untuk record benchmark");
+            }
         }
 
         // --- Menjalankan Tes untuk Kata (jika data berhasil dibaca) ---
         if (read_word_ok && current_words) {
-            printf("\n-- Tes Kata (Ukuran: %d) --\n", current_size);
-            run_test("Bubble Sort", NULL, bubble_sort_str, NULL, current_words, word_count_read, "Kata");
-            run_test("Selection Sort", NULL, selection_sort_str, NULL, current_words, word_count_read, "Kata");
-            run_test("Insertion Sort", NULL, insertion_sort_str, NULL, current_words, word_count_read, "Kata");
-            run_test("Shell Sort", NULL, shell_sort_str, NULL, current_words, word_count_read, "Kata");
-            run_test("Merge Sort", NULL, merge_sort_str, NULL, current_words, word_count_read, "Kata");
-            run_test("Quick Sort", NULL, quick_sort_str, NULL, current_words, word_count_read, "Kata");
+            printf("\n-- Tes Kata (Ukuran: %zu) --\n", current_size);
+            run_test("Bubble Sort", NULL, bubble_sort_str, NULL, current_words, word_count_read, "Kata", 0);
+            run_test("Selection Sort", NULL, selection_sort_str, NULL, current_words, word_count_read, "Kata", 0);
+            run_test("Insertion Sort", NULL, insertion_sort_str, NULL, current_words, word_count_read, "Kata", 0);
+            run_test("Shell Sort", NULL, shell_sort_str, NULL, current_words, word_count_read, "Kata", 0);
+            run_test("Merge Sort", NULL, merge_sort_str_pooled, NULL, current_words, word_count_read, "Kata", 1);
+            run_test("Block Merge", NULL, block_merge_sort_str, NULL, current_words, word_count_read, "Kata", 0);
+            run_test("Quick Sort", NULL, quick_sort_str, NULL, current_words, word_count_read, "Kata", 0);
+            run_test("Merge Inline", NULL, merge_sort_str_inline, NULL, current_words, word_count_read, "Kata", 0);
+            run_test("Quick Inline", NULL, quick_sort_str_inline, NULL, current_words, word_count_read, "Kata", 0);
+            run_test("Sort Auto", NULL, sort_auto_str, NULL, current_words, word_count_read, "Kata", 0);
+            print_sort_auto_decision("sort_auto_str");
         } else {
-             printf("\n-- Tes Kata (Ukuran: %d) DILAWATI --\n", current_size);
+             printf("\n-- Tes Kata (Ukuran: %zu) DILAWATI --\n", current_size);
+        }
+
+        // --- Tes Record Kata: key = pointer kata, payload hingga 64 byte ---
+        if (read_word_ok && current_words) {
+            BenchStrRecord *str_records = (BenchStrRecord *)malloc(word_count_read * sizeof(BenchStrRecord));
+            if (str_records) {
+                for (size_t i = 0; i < word_count_read; i++) {
+                    str_records[i].key = current_words[i];
+                    memset(str_records[i].payload, (int)(i & 0xFF), sizeof(str_records[i].payload));
+                }
+                printf("\n-- Tes Record Kata %zu byte (Ukuran: %zu) --\n", sizeof(BenchStrRecord), current_size);
+                run_record_test("Merge Sort (langsung)", RECORD_DIRECT, ARGSORT_MERGE, NULL, str_records, word_count_read);
+                run_record_test("Merge Sort (key-payload)", RECORD_PAIRS, ARGSORT_MERGE, NULL, str_records, word_count_read);
+                run_record_test("Quick Sort (key-payload)", RECORD_PAIRS, ARGSORT_QUICK, NULL, str_records, word_count_read);
+                run_record_test("Shell Sort (key-payload)", RECORD_PAIRS, ARGSORT_SHELL, NULL, str_records, word_count_read);
+                run_record_test("Quick Sort (argsort)", RECORD_ARGSORT, ARGSORT_QUICK, NULL, str_records, word_count_read);
+                free(str_records);
+            } else {
+                perror("Gagal alokasi memori untuk record kata benchmark");
+            }
         }
 
         // --- BEBASKAN MEMORI untuk ukuran data saat ini ---
-        printf("\nMembersihkan memori untuk ukuran %d...\n", current_size);
+        printf("\nMembersihkan memori untuk ukuran %zu...\n", current_size);
         if (current_numbers) {
             free(current_numbers);
             current_numbers = NULL; // Set ke NULL setelah free
@@ -362,12 +986,47 @@ int main() {
             current_words = NULL; // Set ke NULL setelah free
         }
 
-        printf("--- Selesai Pengujian untuk Ukuran Data: %d ---\n\n", current_size);
+        printf("--- Selesai Pengujian untuk Ukuran Data: %zu ---\n\n", current_size);
 
     } // End loop ukuran data
 
     printf("=================================================\n");
     printf("===== SEMUA PENGUJIAN SELESAI =====\n");
 
-    return 0; // Asumsikan sukses jika program selesai
+    // --- Metadata run ini, dipakai untuk perbandingan dan penyimpanan ---
+    BenchMeta meta;
+    if (bench_config.results_file || bench_config.compare_file) {
+        collect_bench_meta(&meta);
+        bench_copy_field(meta.sort_isa, sizeof(meta.sort_isa), sort_isa_name(sort_kernels.level));
+        bench_copy_field(meta.buffer_pages, sizeof(meta.buffer_pages),
+                         bench_config.use_pool ? buffer_pages_name(bench_pool.arenas[BUFFER_SLOT_DATA].pages) : "malloc");
+    }
+
+    // --- Mode perbandingan: dilakukan sebelum menyimpan agar baseline tidak tertimpa run ini ---
+    int exit_code = 0;
+    if (bench_config.compare_file) {
+        BenchResultList baseline = {NULL, 0, 0};
+        BenchMeta baseline_meta;
+        if (load_last_bench_run(bench_config.compare_file, &baseline, &baseline_meta)) {
+            warn_bench_meta_mismatch(&baseline_meta, &meta);
+            if (compare_bench_results(&baseline, &bench_config.results, &bench_config.compare) > 0) {
+                exit_code = 1;
+            }
+        } else {
+            fprintf(stderr, "Error: Tidak ada run baseline lengkap di %s\n", bench_config.compare_file);
+            exit_code = 2;
+        }
+        bench_list_free(&baseline);
+    }
+
+    // --- Simpan hasil run ini beserta metadata ---
+    if (bench_config.results_file) {
+        if (append_bench_results(bench_config.results_file, &meta, &bench_config.results)) {
+            printf("Hasil disimpan ke %s (commit %s)\n", bench_config.results_file, meta.git_commit);
+        }
+    }
+    bench_list_free(&bench_config.results);
+    buffer_pool_free(&bench_pool);
+
+    return exit_code;
 }
\ No newline at end of file
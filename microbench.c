@@ -0,0 +1,566 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+// --- Platform Specific Includes for Timer & Cycle Counter ---
+#if defined(__linux__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#define MICRO_HAVE_PERF 1
+#else
+#define MICRO_HAVE_PERF 0
+#endif
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define MICRO_HAVE_TSC 1
+#else
+#define MICRO_HAVE_TSC 0
+#endif
+// ------------------------------------------------------------
+
+#include "sorting_algorithms.h"
+#include "data_loader.h"
+
+#define MICRO_DEFAULT_MIN_TIME_MS 50.0 // Waktu total minimum per kasus
+#define MICRO_MIN_ITERATIONS 3
+#define MICRO_MAX_ITERATIONS 1000
+#define MICRO_FEW_UNIQUE 16 // Jumlah nilai berbeda untuk distribusi few-unique
+#define MICRO_MAX_SIZES 16
+
+// === Timer ===
+
+// Waktu monotonic dalam nanodetik (clock() sebagai cadangan di platform lain)
+double now_ns() {
+#if defined(__linux__) || defined(__APPLE__)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+#else
+    return (double)clock() * (1e9 / CLOCKS_PER_SEC);
+#endif
+}
+
+// Sumber penghitung untuk kolom op/cyc (dipilih sekali oleh init_cycle_counter)
+typedef enum {
+    CYCLE_SOURCE_NONE,
+    CYCLE_SOURCE_PERF, // Siklus core user space dari perf_event_open
+    CYCLE_SOURCE_TSC   // Tick referensi TSC (frekuensi tetap, bukan siklus core)
+} CycleSource;
+
+CycleSource cycle_source = CYCLE_SOURCE_NONE;
+int perf_cycles_fd = -1;
+
+/**
+ * @brief Memilih penghitung siklus: PERF_COUNT_HW_CPU_CYCLES lewat
+ *        perf_event_open jika diizinkan, selain itu TSC.
+ * @prinsip TSC berdetak pada frekuensi referensi yang konstan, bukan pada
+ *          frekuensi core saat itu, sehingga saat turbo atau throttling tick
+ *          TSC tidak sama dengan siklus core. Counter perf hanya menghitung
+ *          user space (exclude_kernel) agar tetap bisa dibuka dengan
+ *          perf_event_paranoid = 2; waktu kernel (mis. I/O loader) tidak ikut.
+ */
+void init_cycle_counter() {
+#if MICRO_HAVE_PERF
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    perf_cycles_fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (perf_cycles_fd >= 0) {
+        cycle_source = CYCLE_SOURCE_PERF;
+        return;
+    }
+#endif
+    if (MICRO_HAVE_TSC) cycle_source = CYCLE_SOURCE_TSC;
+}
+
+// Nilai penghitung saat ini dari sumber yang dipilih; 0 jika tidak tersedia
+uint64_t read_cycles() {
+#if MICRO_HAVE_PERF
+    if (cycle_source == CYCLE_SOURCE_PERF) {
+        uint64_t value = 0;
+        if (read(perf_cycles_fd, &value, sizeof(value)) != (ssize_t)sizeof(value)) return 0;
+        return value;
+    }
+#endif
+#if MICRO_HAVE_TSC
+    if (cycle_source == CYCLE_SOURCE_TSC) return __rdtsc();
+#endif
+    return 0;
+}
+
+// Ukuran cache (byte) untuk memberi label working set; nilai cadangan jika tidak diketahui
+size_t cache_size_bytes(int level) {
+    long size = -1;
+#if defined(__linux__) && defined(_SC_LEVEL1_DCACHE_SIZE)
+    if (level == 1) size = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+    else if (level == 2) size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    else size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+    if (size > 0) return (size_t)size;
+    return level == 1 ? 32 * 1024 : level == 2 ? 1024 * 1024 : 8 * 1024 * 1024;
+}
+
+// Label tempat working set berada: L1, L2, LLC, atau DRAM
+const char *residency_label(size_t working_set) {
+    if (working_set <= cache_size_bytes(1)) return "L1";
+    if (working_set <= cache_size_bytes(2)) return "L2";
+    if (working_set <= cache_size_bytes(3)) return "LLC";
+    return "DRAM";
+}
+
+// Buffer pengusir cache untuk baris DRAM (2x LLC, dialokasikan saat pertama dibutuhkan)
+unsigned char *evict_buffer = NULL;
+size_t evict_bytes = 0;
+
+/**
+ * @brief Mengusir isi cache sebelum iterasi yang working set-nya melebihi LLC.
+ * @prinsip reset() baru saja menyalin input, sehingga tanpa langkah ini bagian
+ *          akhir working set masih berada di LLC dan label DRAM hanya
+ *          berdasarkan ukuran. Menulis satu byte per cache line di buffer
+ *          2x LLC menggantikan isi cache dengan data lain. Tidak diukur.
+ */
+void evict_caches() {
+    if (!evict_buffer) {
+        evict_bytes = 2 * cache_size_bytes(3);
+        evict_buffer = (unsigned char *)malloc(evict_bytes);
+        if (!evict_buffer) {
+            perror("Gagal alokasi memori untuk buffer pengusir cache");
+            evict_bytes = 0;
+            return;
+        }
+    }
+    for (size_t i = 0; i < evict_bytes; i += 64) evict_buffer[i]++;
+}
+
+// === Kasus Benchmark ===
+
+// Konteks kernel integer: src tidak berubah, work disalin ulang sebelum setiap iterasi
+typedef struct {
+    const int *src;
+    int *work;
+    int *temp;
+    size_t n;
+    size_t h;
+    size_t result; // Menampung hasil kernel agar tidak dihapus compiler
+} IntCase;
+
+typedef struct {
+    char **src;
+    char **work;
+    char **temp;
+    size_t n;
+    size_t h;
+    size_t result;
+} StrCase;
+
+// Konteks loader: membaca n elemen dari file
+typedef struct {
+    const char *filename;
+    size_t n;
+    size_t result;
+} LoaderCase;
+
+typedef struct {
+    const char *kernel;
+    const char *dist;
+    size_t n;
+    size_t ops;               // Pembagi ns/op: elemen yang diproses (perbandingan untuk strcmp)
+    size_t working_set;
+    void (*reset)(void *ctx); // Tidak diukur
+    void (*run)(void *ctx);   // Diukur
+    void *ctx;
+} MicroCase;
+
+void reset_int(void *ctx) { IntCase *c = (IntCase *)ctx; memcpy(c->work, c->src, c->n * sizeof(int)); }
+void reset_str(void *ctx) { StrCase *c = (StrCase *)ctx; memcpy(c->work, c->src, c->n * sizeof(char *)); }
+void reset_none(void *ctx) { (void)ctx; }
+
+void run_partition_int(void *ctx) { IntCase *c = (IntCase *)ctx; c->result += partition_int(c->work, 0, c->n - 1); }
+void run_partition_str(void *ctx) { StrCase *c = (StrCase *)ctx; c->result += partition_str(c->work, 0, c->n - 1); }
+void run_merge_int(void *ctx) { IntCase *c = (IntCase *)ctx; merge_int(c->work, 0, c->n / 2 - 1, c->n - 1, c->temp); c->result += (size_t)c->work[0]; }
+void run_merge_str(void *ctx) { StrCase *c = (StrCase *)ctx; merge_str(c->work, 0, c->n / 2 - 1, c->n - 1, c->temp); c->result += (size_t)c->work[0][0]; }
+void run_shell_pass_int(void *ctx) { IntCase *c = (IntCase *)ctx; shell_gap_pass_int(c->work, c->n, c->h); c->result += (size_t)c->work[0]; }
+void run_shell_pass_str(void *ctx) { StrCase *c = (StrCase *)ctx; shell_gap_pass_str(c->work, c->n, c->h); c->result += (size_t)c->work[0][0]; }
+
+void run_strcmp(void *ctx) {
+    StrCase *c = (StrCase *)ctx;
+    size_t less = 0;
+    for (size_t i = 0; i + 1 < c->n; i++)
+        less += strcmp(c->src[i], c->src[i + 1]) < 0;
+    c->result += less;
+}
+
+void run_read_numbers(void *ctx) {
+    LoaderCase *c = (LoaderCase *)ctx;
+    int *arr = NULL;
+    size_t count = 0;
+    if (read_numbers(c->filename, &arr, &count, c->n)) {
+        c->result += count;
+        free(arr);
+    }
+}
+
+void run_read_words(void *ctx) {
+    LoaderCase *c = (LoaderCase *)ctx;
+    char **arr = NULL;
+    size_t count = 0;
+    if (read_words(c->filename, &arr, &count, c->n)) {
+        c->result += count;
+        free_words(arr, count);
+    }
+}
+
+void run_read_numbers_parallel(void *ctx) {
+    LoaderCase *c = (LoaderCase *)ctx;
+    int *arr = NULL;
+    size_t count = 0;
+    if (read_numbers_parallel(c->filename, &arr, &count, c->n, 0)) {
+        c->result += count;
+        free(arr);
+    }
+}
+
+void run_read_words_parallel(void *ctx) {
+    LoaderCase *c = (LoaderCase *)ctx;
+    char **arr = NULL;
+    size_t count = 0;
+    if (read_words_parallel(c->filename, &arr, &count, c->n, 0)) {
+        c->result += count;
+        free_words(arr, count);
+    }
+}
+
+int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Menjalankan satu kasus dan mencetak satu baris hasil.
+ * @prinsip Setiap iterasi: reset input (tidak diukur; untuk baris DRAM diikuti
+ *          evict_caches), lalu kernel diukur dengan timer monotonic dan
+ *          penghitung siklus. Iterasi diulang sampai total waktu terukur >=
+ *          min_time_ms (minimal MICRO_MIN_ITERATIONS). Yang dilaporkan adalah
+ *          median per operasi (mc->ops), agar tidak terpengaruh gangguan sesaat.
+ */
+void run_micro_case(const MicroCase *mc, double min_time_ms) {
+    double *times = (double *)malloc(MICRO_MAX_ITERATIONS * sizeof(double));
+    double *cycles = (double *)malloc(MICRO_MAX_ITERATIONS * sizeof(double));
+    if (!times || !cycles) {
+        perror("Gagal alokasi memori untuk hasil microbenchmark");
+        free(times);
+        free(cycles);
+        return;
+    }
+    double total_ns = 0.0;
+    int iters = 0;
+    int cold = strcmp(residency_label(mc->working_set), "DRAM") == 0;
+    while (iters < MICRO_MAX_ITERATIONS && (iters < MICRO_MIN_ITERATIONS || total_ns < min_time_ms * 1e6)) {
+        mc->reset(mc->ctx);
+        if (cold) evict_caches();
+        uint64_t c0 = read_cycles();
+        double t0 = now_ns();
+        mc->run(mc->ctx);
+        double t1 = now_ns();
+        uint64_t c1 = read_cycles();
+        times[iters] = t1 - t0;
+        cycles[iters] = (double)(c1 - c0);
+        total_ns += t1 - t0;
+        iters++;
+    }
+    qsort(times, iters, sizeof(double), compare_double);
+    qsort(cycles, iters, sizeof(double), compare_double);
+    double median_ns = times[iters / 2];
+    double median_cycles = cycles[iters / 2];
+
+    printf("%-22s %-11s %10zu %10zu  %-5s %10.3f ", mc->kernel, mc->dist, mc->n,
+           mc->working_set / 1024, residency_label(mc->working_set), median_ns / (double)mc->ops);
+    if (cycle_source != CYCLE_SOURCE_NONE && median_cycles > 0) {
+        printf("%10.3f", (double)mc->ops / median_cycles);
+    } else {
+        printf("%10s", "-");
+    }
+    printf(" %6d\n", iters);
+    fflush(stdout);
+    free(times);
+    free(cycles);
+}
+
+// === Pembuatan Data ===
+
+// Distribusi integer: random, sorted, reversed, few-unique
+void fill_int_distribution(int *arr, size_t n, const char *dist) {
+    for (size_t i = 0; i < n; i++) {
+        if (strcmp(dist, "sorted") == 0) arr[i] = (int)i;
+        else if (strcmp(dist, "reversed") == 0) arr[i] = (int)(n - i);
+        else if (strcmp(dist, "few-unique") == 0) arr[i] = rand() % MICRO_FEW_UNIQUE;
+        else arr[i] = rand();
+    }
+}
+
+// Kata acak a-z dengan panjang 3-15 (sama seperti generate_data.c)
+char *make_random_word() {
+    int length = 3 + rand() % 13;
+    char *w = (char *)malloc(length + 1);
+    if (!w) return NULL;
+    for (int i = 0; i < length; i++) w[i] = (char)('a' + rand() % 26);
+    w[length] = '\0';
+    return w;
+}
+
+int compare_str_ptr(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+// Distribusi string berdasarkan pool kata: random (urutan asli), sorted, few-unique
+void fill_str_distribution(char **arr, char **pool, size_t n, const char *dist) {
+    if (strcmp(dist, "few-unique") == 0) {
+        for (size_t i = 0; i < n; i++) arr[i] = pool[rand() % MICRO_FEW_UNIQUE];
+        return;
+    }
+    memcpy(arr, pool, n * sizeof(char *));
+    if (strcmp(dist, "sorted") == 0) qsort(arr, n, sizeof(char *), compare_str_ptr);
+}
+
+// Gap Knuth terbesar yang dipakai shell_sort_* untuk n elemen
+size_t largest_knuth_gap(size_t n) {
+    size_t h = 1;
+    while (h < n / 3) h = 3 * h + 1;
+    return h;
+}
+
+// Menyiapkan input untuk pass h = 1: semua pass dengan gap lebih besar sudah dijalankan
+void presort_larger_gaps_int(int *arr, size_t n) {
+    for (size_t h = largest_knuth_gap(n); h > 1; h /= 3) shell_gap_pass_int(arr, n, h);
+}
+
+void presort_larger_gaps_str(char **arr, size_t n) {
+    for (size_t h = largest_knuth_gap(n); h > 1; h /= 3) shell_gap_pass_str(arr, n, h);
+}
+
+// === Main ===
+
+void print_usage(const char *program) {
+    printf("Pemakaian: %s [opsi]\n", program);
+    printf("  --kernel NAMA     Hanya jalankan kernel yang namanya mengandung NAMA\n");
+    printf("  --sizes a,b,c     Daftar ukuran (default 1024,16384,262144,4194304)\n");
+    printf("  --min-time MS     Waktu terukur minimum per kasus (default %.0f ms)\n", MICRO_DEFAULT_MIN_TIME_MS);
+}
+
+int kernel_selected(const char *filter, const char *kernel) {
+    return filter == NULL || strstr(kernel, filter) != NULL;
+}
+
+int main(int argc, char *argv[]) {
+    size_t sizes[MICRO_MAX_SIZES] = {1024, 16384, 262144, 4194304};
+    size_t num_sizes = 4;
+    const char *filter = NULL;
+    double min_time_ms = MICRO_DEFAULT_MIN_TIME_MS;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--kernel") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            min_time_ms = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--sizes") == 0 && i + 1 < argc) {
+            char *p = argv[++i];
+            num_sizes = 0;
+            while (*p && num_sizes < MICRO_MAX_SIZES) {
+                size_t v = (size_t)strtoull(p, &p, 10);
+                if (v >= 2) sizes[num_sizes++] = v;
+                if (*p == ',') p++;
+                else if (*p) break;
+            }
+        } else {
+            print_usage(argv[0]);
+            return 2;
+        }
+    }
+    if (num_sizes == 0) {
+        print_usage(argv[0]);
+        return 2;
+    }
+
+    size_t max_n = 0;
+    for (size_t s = 0; s < num_sizes; s++)
+        if (sizes[s] > max_n) max_n = sizes[s];
+
+    srand(12345); // Seed tetap agar input sama antar run
+
+    // --- Pool kata: dari DATA_KATA_FILE jika ada, selain itu dibangkitkan ---
+    char **pool = NULL;
+    size_t pool_count = 0;
+    int pool_from_file = 0;
+    FILE *probe = fopen(DATA_KATA_FILE, "r");
+    if (probe) {
+        fclose(probe);
+        if (read_words(DATA_KATA_FILE, &pool, &pool_count, max_n)) pool_from_file = 1;
+    }
+    if (pool_count < max_n) {
+        char **temp = (char **)realloc(pool, max_n * sizeof(char *));
+        if (!temp) {
+            perror("Gagal alokasi memori untuk pool kata");
+            free_words(pool, pool_count);
+            return 1;
+        }
+        pool = temp;
+        while (pool_count < max_n) {
+            pool[pool_count] = make_random_word();
+            if (!pool[pool_count]) {
+                perror("Gagal alokasi memori untuk kata");
+                free_words(pool, pool_count);
+                return 1;
+            }
+            pool_count++;
+        }
+    }
+    size_t pool_bytes = 0;
+    for (size_t i = 0; i < pool_count; i++) pool_bytes += strlen(pool[i]) + 1;
+    double avg_word_bytes = (double)pool_bytes / (double)pool_count;
+
+    int *src_int = (int *)malloc(max_n * sizeof(int));
+    int *work_int = (int *)malloc(max_n * sizeof(int));
+    int *temp_int = (int *)malloc((max_n / 2 + 1) * sizeof(int));
+    char **src_str = (char **)malloc(max_n * sizeof(char *));
+    char **work_str = (char **)malloc(max_n * sizeof(char *));
+    char **temp_str = (char **)malloc((max_n / 2 + 1) * sizeof(char *));
+    if (!src_int || !work_int || !temp_int || !src_str || !work_str || !temp_str) {
+        perror("Gagal alokasi memori untuk buffer microbenchmark");
+        return 1;
+    }
+
+    init_cycle_counter();
+    printf("===== MICROBENCHMARK KERNEL SORTING =====\n");
+    printf("Cache: L1 %zu KB, L2 %zu KB, LLC %zu KB | Kata: %s | Cycle: %s\n",
+           cache_size_bytes(1) / 1024, cache_size_bytes(2) / 1024, cache_size_bytes(3) / 1024,
+           pool_from_file ? DATA_KATA_FILE : "dibangkitkan",
+           cycle_source == CYCLE_SOURCE_PERF ? "perf (siklus core, user space)" :
+           cycle_source == CYCLE_SOURCE_TSC ? "TSC (tick referensi, bukan siklus core)" : "tidak tersedia");
+    printf("op = elemen yang diproses (strcmp: perbandingan); baris DRAM diukur setelah cache diusir\n");
+    printf("%-22s %-11s %10s %10s  %-5s %10s %10s %6s\n",
+           "Kernel", "Distribusi", "N", "WS (KB)", "Level", "ns/op",
+           cycle_source == CYCLE_SOURCE_TSC ? "op/tick" : "op/cyc", "iter");
+
+    const char *int_dists[] = {"random", "sorted", "reversed", "few-unique"};
+    const char *str_dists[] = {"random", "sorted", "few-unique"};
+    IntCase ic;
+    StrCase sc;
+    MicroCase mc;
+
+    for (size_t s = 0; s < num_sizes; s++) {
+        size_t n = sizes[s];
+        size_t str_ws = (size_t)((double)n * (sizeof(char *) + avg_word_bytes));
+
+        // --- Kernel integer ---
+        for (size_t d = 0; d < sizeof(int_dists) / sizeof(int_dists[0]); d++) {
+            memset(&ic, 0, sizeof(ic));
+            ic.src = src_int; ic.work = work_int; ic.temp = temp_int; ic.n = n;
+            mc.dist = int_dists[d]; mc.n = n; mc.ops = n; mc.reset = reset_int; mc.ctx = &ic;
+
+            fill_int_distribution(src_int, n, int_dists[d]);
+            if (kernel_selected(filter, "partition_int")) {
+                mc.kernel = "partition_int"; mc.working_set = n * sizeof(int); mc.run = run_partition_int;
+                run_micro_case(&mc, min_time_ms);
+            }
+            if (kernel_selected(filter, "shell_pass_int(hmax)")) {
+                ic.h = largest_knuth_gap(n);
+                mc.kernel = "shell_pass_int(hmax)"; mc.working_set = n * sizeof(int); mc.run = run_shell_pass_int;
+                run_micro_case(&mc, min_time_ms);
+            }
+            if (kernel_selected(filter, "shell_pass_int(h=1)")) {
+                fill_int_distribution(src_int, n, int_dists[d]);
+                presort_larger_gaps_int(src_int, n);
+                ic.h = 1;
+                mc.kernel = "shell_pass_int(h=1)"; mc.working_set = n * sizeof(int); mc.run = run_shell_pass_int;
+                run_micro_case(&mc, min_time_ms);
+            }
+            if (kernel_selected(filter, "merge_int")) {
+                // Input merge: dua paruh yang masing-masing sudah terurut
+                fill_int_distribution(src_int, n, int_dists[d]);
+                merge_sort_int(src_int, n / 2);
+                merge_sort_int(src_int + n / 2, n - n / 2);
+                mc.kernel = "merge_int"; mc.working_set = (n + n / 2) * sizeof(int); mc.run = run_merge_int;
+                run_micro_case(&mc, min_time_ms);
+            }
+        }
+
+        // --- Kernel string ---
+        for (size_t d = 0; d < sizeof(str_dists) / sizeof(str_dists[0]); d++) {
+            memset(&sc, 0, sizeof(sc));
+            sc.src = src_str; sc.work = work_str; sc.temp = temp_str; sc.n = n;
+            mc.dist = str_dists[d]; mc.n = n; mc.ops = n; mc.reset = reset_str; mc.ctx = &sc;
+
+            fill_str_distribution(src_str, pool, n, str_dists[d]);
+            if (kernel_selected(filter, "strcmp")) {
+                mc.kernel = "strcmp (adjacent)"; mc.working_set = str_ws; mc.run = run_strcmp; mc.reset = reset_none;
+                mc.ops = n - 1; // n - 1 perbandingan pasangan bertetangga
+                run_micro_case(&mc, min_time_ms);
+                mc.reset = reset_str;
+                mc.ops = n;
+            }
+            if (kernel_selected(filter, "partition_str")) {
+                mc.kernel = "partition_str"; mc.working_set = str_ws; mc.run = run_partition_str;
+                run_micro_case(&mc, min_time_ms);
+            }
+            if (kernel_selected(filter, "shell_pass_str(hmax)")) {
+                sc.h = largest_knuth_gap(n);
+                mc.kernel = "shell_pass_str(hmax)"; mc.working_set = str_ws; mc.run = run_shell_pass_str;
+                run_micro_case(&mc, min_time_ms);
+            }
+            if (kernel_selected(filter, "shell_pass_str(h=1)")) {
+                presort_larger_gaps_str(src_str, n);
+                sc.h = 1;
+                mc.kernel = "shell_pass_str(h=1)"; mc.working_set = str_ws; mc.run = run_shell_pass_str;
+                run_micro_case(&mc, min_time_ms);
+            }
+            if (kernel_selected(filter, "merge_str")) {
+                fill_str_distribution(src_str, pool, n, str_dists[d]);
+                merge_sort_str(src_str, n / 2);
+                merge_sort_str(src_str + n / 2, n - n / 2);
+                mc.kernel = "merge_str"; mc.working_set = str_ws + (n / 2) * sizeof(char *); mc.run = run_merge_str;
+                run_micro_case(&mc, min_time_ms);
+            }
+        }
+
+        // --- Loader (membaca dari file; dilewati jika file tidak ada) ---
+        LoaderCase lc;
+        const char *loader_files[] = {DATA_ANGKA_FILE, DATA_KATA_FILE, DATA_ANGKA_FILE, DATA_KATA_FILE};
+        const char *loader_names[] = {"read_numbers", "read_words", "read_numbers_parallel", "read_words_parallel"};
+        void (*loader_runs[])(void *) = {run_read_numbers, run_read_words, run_read_numbers_parallel, run_read_words_parallel};
+        for (int l = 0; l < 4; l++) {
+            if (!kernel_selected(filter, loader_names[l])) continue;
+            FILE *fp = fopen(loader_files[l], "r");
+            if (!fp) continue;
+            fclose(fp);
+            lc.filename = loader_files[l]; lc.n = n; lc.result = 0;
+            // Probe sekali (tidak diukur): lewati ukuran yang lebih besar dari isi file
+            loader_runs[l](&lc);
+            if (lc.result < n) {
+                printf("%-22s %-11s %10zu  (dilewati: file hanya berisi %zu baris)\n", loader_names[l], "file", n, lc.result);
+                continue;
+            }
+            mc.kernel = loader_names[l]; mc.dist = "file"; mc.n = n; mc.ops = n;
+            mc.working_set = l % 2 == 0 ? n * sizeof(int) : str_ws;
+            mc.reset = reset_none; mc.run = loader_runs[l]; mc.ctx = &lc;
+            run_micro_case(&mc, min_time_ms);
+        }
+    }
+
+    free(src_int); free(work_int); free(temp_int);
+    free(src_str); free(work_str); free(temp_str);
+    free_words(pool, pool_count);
+    free(evict_buffer);
+#if MICRO_HAVE_PERF
+    if (perf_cycles_fd >= 0) close(perf_cycles_fd);
+#endif
+    return 0;
+}
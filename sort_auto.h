@@ -0,0 +1,442 @@
+#ifndef SORT_AUTO_H
+#define SORT_AUTO_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sorting_algorithms.h"
+#include "sort_dispatch.h" // quick_sort_int_dispatch, merge_sort_int_dispatch
+
+// Batas atas ukuran sampel (buffer sampel ada di stack).
+#define SORT_AUTO_MAX_SAMPLE 1024
+
+// === Algoritma yang Bisa Dipilih ===
+
+typedef enum {
+    SORT_AUTO_NONE = 0,        // Sudah terurut: tidak ada yang dikerjakan
+    SORT_AUTO_REVERSE,         // Terurut menurun: cukup dibalik
+    SORT_AUTO_INSERTION,       // insertion_sort_*
+    SORT_AUTO_COUNTING,        // counting_sort_int
+    SORT_AUTO_MERGE_DISPATCH,  // merge_sort_int_dispatch (lewati merge bagian yang sudah berurutan)
+    SORT_AUTO_QUICK_DISPATCH,  // quick_sort_int_dispatch (median-of-three, kernel ISA)
+    SORT_AUTO_MERGE,           // merge_sort_str
+    SORT_AUTO_MERGE_INLINE,    // merge_sort_str_inline
+    SORT_AUTO_QUICK_INLINE     // quick_sort_str_inline
+} SortAutoAlgo;
+
+const char *sort_auto_algo_name(SortAutoAlgo algo) {
+    switch (algo) {
+        case SORT_AUTO_NONE:           return "none";
+        case SORT_AUTO_REVERSE:        return "reverse";
+        case SORT_AUTO_INSERTION:      return "insertion";
+        case SORT_AUTO_COUNTING:       return "counting";
+        case SORT_AUTO_MERGE_DISPATCH: return "merge_dispatch";
+        case SORT_AUTO_QUICK_DISPATCH: return "quick_dispatch";
+        case SORT_AUTO_MERGE:          return "merge";
+        case SORT_AUTO_MERGE_INLINE:   return "merge_inline";
+        case SORT_AUTO_QUICK_INLINE:   return "quick_inline";
+        default:                       return "unknown";
+    }
+}
+
+// === Tabel Keputusan (bisa diubah lewat sort_auto_init / env SORT_AUTO_TABLE) ===
+
+/**
+ * Nilai default dikalibrasi pada 1M angka/kata (-O2, kernel AVX-512):
+ * - small_n: quick_sort_int_dispatch sendiri sudah lebih cepat dari Insertion
+ *   Sort mulai 16 elemen (0.07 vs 0.13 us), tetapi sampling menambah ~0.3 us;
+ *   Insertion Sort tetap menang sampai ~48 elemen acak (0.61 vs 0.69 us
+ *   termasuk sampling) dan kalah di 64 (1.07 vs 0.83 us).
+ * - presorted_*: merge dispatch menang jika hampir tidak ada pasangan turun
+ *   (swap 0.1%: 13 vs 43 ms) tetapi kalah saat turun ~1% (19 vs 18 ms).
+ * - Kunci kembar tidak punya aturan sendiri: kedua quick sort melewati kunci
+ *   yang sama dengan pivot (2M angka, 1000 nilai berbeda: quick dispatch 8.7
+ *   vs merge dispatch 48 ms; 2M kata duplikat: quick inline 0.28 vs 0.51 s).
+ * - counting_*: partisi vektor membuat quick dispatch menang pada rentang ~n
+ *   (12 vs 17 ms di 1M); Counting Sort menang mulai rentang n/2 (10 vs 12 ms
+ *   di 1M, 47 vs 70 us di 10k). Pada level scalar Counting Sort masih menang
+ *   di rentang n (17 vs 25 ms), jadi host tanpa AVX sebaiknya menaikkan
+ *   counting_range_per_elem lewat SORT_AUTO_TABLE.
+ * - inline_max_prefix: record inline menang hingga prefix bersama ~12
+ *   karakter (333 vs 663 ms), kalah pada prefix 22 (866 vs 651 ms).
+ * - quick_min_descents: merge inline memanfaatkan run panjang; 2M kata
+ *   gergaji (turun 0.016): merge inline 0.22 s vs quick inline 1.7 s.
+ */
+typedef struct {
+    size_t sample_size;             // Jumlah elemen sampel (<= SORT_AUTO_MAX_SAMPLE)
+    size_t small_n;                 // n < small_n: Insertion Sort tanpa sampling
+    double presorted_descents;      // Rasio pasangan bertetangga yang turun <= ini: hampir terurut
+    double presorted_inversions;    // Rasio inversi sampel <= ini: hampir terurut
+    double counting_range_per_elem; // Rentang kunci sampel <= ini * n: Counting Sort
+    size_t counting_max_range;      // Batas absolut rentang Counting Sort (memori counts)
+    double inline_max_prefix;       // Rata-rata prefix bersama kata <= ini: record inline
+    double quick_min_descents;      // String: Quick Sort hanya jika rasio turun >= ini
+} SortAutoTable;
+
+SortAutoTable sort_auto_table = {256, 48, 0.005, 0.001, 0.5, (size_t)1 << 24, 14.0, 0.3};
+
+// === Profil Input & Keputusan Terakhir ===
+
+typedef struct {
+    size_t n;
+    size_t sample;          // Jumlah elemen sampel yang dipakai
+    double descent_ratio;   // Perkiraan rasio arr[i] > arr[i+1] (runs ~ descent_ratio * n + 1)
+    double inversion_ratio; // Rasio pasangan sampel yang terbalik (0 = terurut, 1 = menurun)
+    double duplicate_ratio; // 1 - (nilai berbeda / ukuran sampel)
+    int64_t key_range;      // max - min sampel (hanya int)
+    double avg_length;      // Rata-rata panjang string sampel (hanya str)
+    double avg_prefix;      // Rata-rata prefix bersama tetangga di sampel terurut (hanya str)
+    int sorted;             // 1 jika seluruh array terverifikasi terurut naik
+    int reversed;           // 1 jika seluruh array terverifikasi tidak naik
+} SortAutoProfile;
+
+typedef struct {
+    SortAutoProfile profile;
+    SortAutoAlgo algo;
+    const char *reason;
+} SortAutoDecision;
+
+SortAutoDecision sort_auto_last; // Keputusan panggilan sort_auto_* terakhir
+FILE *sort_auto_log = NULL;      // Jika tidak NULL, setiap keputusan dicetak ke sini
+
+// Mencetak satu keputusan dalam satu baris
+void sort_auto_print_decision(FILE *fp, const char *func, const SortAutoDecision *d) {
+    const SortAutoProfile *p = &d->profile;
+    fprintf(fp, "%s: n=%zu sampel=%zu turun=%.3f inversi=%.3f duplikat=%.3f", func, p->n, p->sample,
+            p->descent_ratio, p->inversion_ratio, p->duplicate_ratio);
+    if (p->avg_length > 0) fprintf(fp, " panjang=%.1f prefix=%.1f", p->avg_length, p->avg_prefix);
+    else fprintf(fp, " rentang=%lld", (long long)p->key_range);
+    fprintf(fp, " -> %s (%s)\n", sort_auto_algo_name(d->algo), d->reason);
+}
+
+void sort_auto_record(const char *func, const SortAutoProfile *profile, SortAutoAlgo algo, const char *reason) {
+    sort_auto_last.profile = *profile;
+    sort_auto_last.algo = algo;
+    sort_auto_last.reason = reason;
+    if (sort_auto_log) sort_auto_print_decision(sort_auto_log, func, &sort_auto_last);
+}
+
+/**
+ * @brief Mengubah entri tabel keputusan dari string "kunci=nilai,kunci=nilai".
+ * @prinsip Kunci sama dengan nama field SortAutoTable. Kunci yang tidak dikenal
+ *          dilaporkan lalu diabaikan.
+ * @return Jumlah entri yang berhasil diubah.
+ */
+int sort_auto_configure(const char *spec) {
+    int applied = 0;
+    while (spec && *spec) {
+        char key[40];
+        double value;
+        int consumed = 0;
+        if (sscanf(spec, " %39[^=,]=%lf%n", key, &value, &consumed) != 2) {
+            fprintf(stderr, "Warning: Entri tabel sort_auto tidak valid: %s\n", spec);
+            break;
+        }
+        if (strcmp(key, "sample_size") == 0) {
+            sort_auto_table.sample_size = value < 2 ? 2 : value > SORT_AUTO_MAX_SAMPLE ? SORT_AUTO_MAX_SAMPLE : (size_t)value;
+        } else if (strcmp(key, "small_n") == 0) {
+            sort_auto_table.small_n = value < 0 ? 0 : (size_t)value;
+        } else if (strcmp(key, "presorted_descents") == 0) {
+            sort_auto_table.presorted_descents = value;
+        } else if (strcmp(key, "presorted_inversions") == 0) {
+            sort_auto_table.presorted_inversions = value;
+        } else if (strcmp(key, "counting_range_per_elem") == 0) {
+            sort_auto_table.counting_range_per_elem = value;
+        } else if (strcmp(key, "counting_max_range") == 0) {
+            sort_auto_table.counting_max_range = value < 0 ? 0 : (size_t)value;
+        } else if (strcmp(key, "inline_max_prefix") == 0) {
+            sort_auto_table.inline_max_prefix = value;
+        } else if (strcmp(key, "quick_min_descents") == 0) {
+            sort_auto_table.quick_min_descents = value;
+        } else {
+            fprintf(stderr, "Warning: Kunci tabel sort_auto tidak dikenal: %s\n", key);
+            applied--;
+        }
+        applied++;
+        spec += consumed;
+        if (*spec == ',') spec++;
+    }
+    return applied;
+}
+
+/**
+ * @brief Menyiapkan auto-selector sekali saat startup.
+ * @param spec Perubahan tabel "kunci=nilai,..." (NULL = pakai env SORT_AUTO_TABLE).
+ * @prinsip Env SORT_AUTO_LOG=1 mengarahkan log keputusan ke stderr.
+ */
+void sort_auto_init(const char *spec) {
+    const char *requested = spec ? spec : getenv("SORT_AUTO_TABLE");
+    if (requested && requested[0] != '\0') sort_auto_configure(requested);
+    const char *log = getenv("SORT_AUTO_LOG");
+    if (log && strcmp(log, "1") == 0) sort_auto_log = stderr;
+}
+
+// === Sampling ===
+
+// Ukuran sampel: sample_size, tetapi paling banyak n/8 (min 16) agar biaya sampling kecil untuk n kecil
+size_t sort_auto_sample_size(size_t n) {
+    size_t s = sort_auto_table.sample_size;
+    if (s > SORT_AUTO_MAX_SAMPLE) s = SORT_AUTO_MAX_SAMPLE;
+    if (s > n / 8) s = n / 8 < 16 ? 16 : n / 8;
+    return s < n ? s : n;
+}
+
+// Posisi sampel ke-i dari s, tersebar rata di [0, n)
+size_t sort_auto_sample_pos(size_t i, size_t s, size_t n) {
+    return s > 1 ? (size_t)((double)i * (double)(n - 1) / (double)(s - 1)) : 0;
+}
+
+// Merge Sort pada sampel sambil menghitung inversi (pasangan i < j dengan a[i] > a[j])
+uint64_t sort_auto_count_inversions_int(int a[], size_t n, int tmp[]) {
+    if (n < 2) return 0;
+    size_t mid = n / 2;
+    uint64_t inv = sort_auto_count_inversions_int(a, mid, tmp) + sort_auto_count_inversions_int(a + mid, n - mid, tmp);
+    size_t i = 0, j = mid, k = 0;
+    while (i < mid && j < n) {
+        if (a[i] <= a[j]) tmp[k++] = a[i++];
+        else { tmp[k++] = a[j++]; inv += mid - i; }
+    }
+    while (i < mid) tmp[k++] = a[i++];
+    while (j < n) tmp[k++] = a[j++];
+    memcpy(a, tmp, n * sizeof(int));
+    return inv;
+}
+
+uint64_t sort_auto_count_inversions_str(char *a[], size_t n, char *tmp[]) {
+    if (n < 2) return 0;
+    size_t mid = n / 2;
+    uint64_t inv = sort_auto_count_inversions_str(a, mid, tmp) + sort_auto_count_inversions_str(a + mid, n - mid, tmp);
+    size_t i = 0, j = mid, k = 0;
+    while (i < mid && j < n) {
+        if (strcmp(a[i], a[j]) <= 0) tmp[k++] = a[i++];
+        else { tmp[k++] = a[j++]; inv += mid - i; }
+    }
+    while (i < mid) tmp[k++] = a[i++];
+    while (j < n) tmp[k++] = a[j++];
+    memcpy(a, tmp, n * sizeof(char *));
+    return inv;
+}
+
+/**
+ * @brief Mengukur karakteristik input dari sampel kecil.
+ * @prinsip Sampel s elemen diambil merata di seluruh array. Untuk setiap
+ *          posisi sampel, pasangan (arr[pos], arr[pos+1]) ikut dicek untuk
+ *          memperkirakan jumlah run. Sampel diurutkan dengan merge sort yang
+ *          menghitung inversi (O(s log s)), lalu dari sampel terurut dihitung
+ *          rasio duplikat dan rentang kunci. Hanya jika sampel terlihat
+ *          terurut (atau tidak naik) seluruh array dicek satu pass O(n).
+ *          Sampel dianggap tidak naik jika setiap pasangan adalah inversi
+ *          atau kunci sama, sehingga input menurun dengan kunci kembar tetap
+ *          terdeteksi.
+ */
+void sort_auto_profile_int(const int arr[], size_t n, SortAutoProfile *p) {
+    int sample[SORT_AUTO_MAX_SAMPLE], tmp[SORT_AUTO_MAX_SAMPLE];
+    size_t s = sort_auto_sample_size(n);
+    size_t pairs = 0, descents = 0, ascents = 0;
+    memset(p, 0, sizeof(*p));
+    p->n = n;
+    p->sample = s;
+
+    for (size_t i = 0; i < s; i++) {
+        size_t pos = sort_auto_sample_pos(i, s, n);
+        sample[i] = arr[pos];
+        if (pos + 1 < n) {
+            pairs++;
+            descents += arr[pos] > arr[pos + 1];
+            ascents += arr[pos] < arr[pos + 1];
+        }
+    }
+    uint64_t total_pairs = (uint64_t)s * (s - 1) / 2;
+    uint64_t inv = sort_auto_count_inversions_int(sample, s, tmp);
+    uint64_t equal_pairs = 0;
+    size_t distinct = s > 0, run = 1;
+    for (size_t i = 1; i < s; i++) {
+        if (sample[i] != sample[i - 1]) { distinct++; run = 1; }
+        else equal_pairs += run++;
+    }
+
+    p->descent_ratio = pairs ? (double)descents / pairs : 0.0;
+    p->inversion_ratio = total_pairs ? (double)inv / total_pairs : 0.0;
+    p->duplicate_ratio = s ? 1.0 - (double)distinct / s : 0.0;
+    p->key_range = s ? (int64_t)sample[s - 1] - sample[0] : 0;
+
+    if (descents == 0 && inv == 0) {
+        p->sorted = 1;
+        for (size_t i = 1; i < n && p->sorted; i++) p->sorted = arr[i - 1] <= arr[i];
+    } else if (ascents == 0 && inv + equal_pairs == total_pairs) {
+        p->reversed = 1;
+        for (size_t i = 1; i < n && p->reversed; i++) p->reversed = arr[i - 1] >= arr[i];
+    }
+}
+
+// Versi string dari sort_auto_profile_int (tanpa rentang kunci; dengan rata-rata panjang & prefix bersama)
+void sort_auto_profile_str(char *const arr[], size_t n, SortAutoProfile *p) {
+    char *sample[SORT_AUTO_MAX_SAMPLE], *tmp[SORT_AUTO_MAX_SAMPLE];
+    size_t s = sort_auto_sample_size(n);
+    size_t pairs = 0, descents = 0, ascents = 0, length = 0, prefix = 0;
+    memset(p, 0, sizeof(*p));
+    p->n = n;
+    p->sample = s;
+
+    for (size_t i = 0; i < s; i++) {
+        size_t pos = sort_auto_sample_pos(i, s, n);
+        sample[i] = arr[pos];
+        length += strlen(arr[pos]);
+        if (pos + 1 < n) {
+            int c = strcmp(arr[pos], arr[pos + 1]);
+            pairs++;
+            descents += c > 0;
+            ascents += c < 0;
+        }
+    }
+    uint64_t total_pairs = (uint64_t)s * (s - 1) / 2;
+    uint64_t inv = sort_auto_count_inversions_str(sample, s, tmp);
+    uint64_t equal_pairs = 0;
+    size_t distinct = s > 0, run = 1;
+    for (size_t i = 1; i < s; i++) {
+        const char *a = sample[i - 1], *b = sample[i];
+        size_t k = 0;
+        while (a[k] && a[k] == b[k]) k++;
+        prefix += k;
+        if (a[k] != b[k]) { distinct++; run = 1; }
+        else equal_pairs += run++;
+    }
+
+    p->descent_ratio = pairs ? (double)descents / pairs : 0.0;
+    p->inversion_ratio = total_pairs ? (double)inv / total_pairs : 0.0;
+    p->duplicate_ratio = s ? 1.0 - (double)distinct / s : 0.0;
+    p->avg_length = s ? (double)length / s : 0.0;
+    p->avg_prefix = s > 1 ? (double)prefix / (s - 1) : 0.0;
+
+    if (descents == 0 && inv == 0) {
+        p->sorted = 1;
+        for (size_t i = 1; i < n && p->sorted; i++) p->sorted = strcmp(arr[i - 1], arr[i]) <= 0;
+    } else if (ascents == 0 && inv + equal_pairs == total_pairs) {
+        p->reversed = 1;
+        for (size_t i = 1; i < n && p->reversed; i++) p->reversed = strcmp(arr[i - 1], arr[i]) >= 0;
+    }
+}
+
+/**
+ * @brief Membalik array string yang tidak naik menjadi terurut naik secara stabil.
+ * @prinsip Seluruh array dibalik, lalu setiap deretan string yang sama dibalik
+ *          lagi sehingga urutan relatifnya kembali seperti semula. Hanya
+ *          bagian yang benar-benar menurun yang berpindah urutan.
+ */
+void sort_auto_reverse_stable_str(char *arr[], size_t n) {
+    reverse_range_str(arr, 0, n);
+    size_t start = 0;
+    for (size_t i = 1; i <= n; i++) {
+        if (i == n || strcmp(arr[i - 1], arr[i]) != 0) {
+            if (i - start > 1) reverse_range_str(arr, start, i);
+            start = i;
+        }
+    }
+}
+
+// === Front End ===
+
+// Rentang maksimum untuk counting_sort_int: batas per elemen dan batas absolut.
+// Rentang sampel bisa jauh lebih kecil dari rentang seluruh array (satu outlier
+// yang tidak tersampel), jadi batas per elemen ikut dicek terhadap rentang penuh
+// sebelum calloc.
+size_t sort_auto_counting_limit(const SortAutoTable *t, size_t n) {
+    double per_elem = t->counting_range_per_elem * (double)n;
+    return per_elem < (double)t->counting_max_range ? (size_t)per_elem : t->counting_max_range;
+}
+
+/**
+ * @brief Mengurutkan array integer dengan algoritma yang dipilih dari profil input.
+ * @prinsip Urutan aturan (lihat SortAutoTable):
+ *          1. n < small_n                         -> Insertion Sort
+ *          2. terurut / menurun (terverifikasi)   -> tidak ada / dibalik
+ *          3. hampir terurut (run sedikit atau inversi kecil) -> merge dispatch
+ *          4. rentang kunci <= range_per_elem * n -> Counting Sort
+ *          5. selain itu (acak, boleh banyak duplikat) -> quick dispatch
+ *          Keputusan disimpan di sort_auto_last dan dicetak ke sort_auto_log.
+ *          Hasil tidak dijamin stabil (tidak relevan untuk int).
+ * @param arr Array integer yang akan diurutkan.
+ * @param n Jumlah elemen dalam array.
+ */
+void sort_auto_int(int arr[], size_t n) {
+    SortAutoProfile profile;
+    const SortAutoTable *t = &sort_auto_table;
+
+    if (n < t->small_n || n < 2) {
+        memset(&profile, 0, sizeof(profile));
+        profile.n = n;
+        sort_auto_record("sort_auto_int", &profile, SORT_AUTO_INSERTION, "n kecil");
+        insertion_sort_int(arr, n);
+        return;
+    }
+    sort_auto_profile_int(arr, n, &profile);
+
+    if (profile.sorted) {
+        sort_auto_record("sort_auto_int", &profile, SORT_AUTO_NONE, "sudah terurut");
+    } else if (profile.reversed) {
+        sort_auto_record("sort_auto_int", &profile, SORT_AUTO_REVERSE, "terurut menurun");
+        reverse_range_int(arr, 0, n);
+    } else if (profile.descent_ratio <= t->presorted_descents || profile.inversion_ratio <= t->presorted_inversions) {
+        sort_auto_record("sort_auto_int", &profile, SORT_AUTO_MERGE_DISPATCH, "hampir terurut");
+        merge_sort_int_dispatch(arr, n);
+    } else if ((double)profile.key_range <= t->counting_range_per_elem * (double)n &&
+               counting_sort_int(arr, n, sort_auto_counting_limit(t, n))) {
+        sort_auto_record("sort_auto_int", &profile, SORT_AUTO_COUNTING, "rentang kunci kecil");
+    } else {
+        sort_auto_record("sort_auto_int", &profile, SORT_AUTO_QUICK_DISPATCH, "acak");
+        quick_sort_int_dispatch(arr, n);
+    }
+}
+
+/**
+ * @brief Mengurutkan array string dengan algoritma yang dipilih dari profil input.
+ * @prinsip Sama seperti sort_auto_int, tetapi tanpa Counting Sort. Jika kata
+ *          umumnya sudah berbeda dalam 16 byte pertama (prefix bersama <=
+ *          inline_max_prefix) dipakai record inline. Data acak memakai
+ *          quick_sort_str_inline; hampir terurut atau sebagian terurut
+ *          memakai varian merge yang lebih cepat pada run
+ *          panjang. Input menurun dibalik secara stabil. Hasil tidak dijamin
+ *          stabil: string yang sama bisa bertukar urutan pada jalur
+ *          quick_sort_str_inline.
+ * @param arr Array pointer ke string (char*) yang akan diurutkan.
+ * @param n Jumlah elemen dalam array.
+ */
+void sort_auto_str(char *arr[], size_t n) {
+    SortAutoProfile profile;
+    const SortAutoTable *t = &sort_auto_table;
+
+    if (n < t->small_n || n < 2) {
+        memset(&profile, 0, sizeof(profile));
+        profile.n = n;
+        sort_auto_record("sort_auto_str", &profile, SORT_AUTO_INSERTION, "n kecil");
+        insertion_sort_str(arr, n);
+        return;
+    }
+    sort_auto_profile_str(arr, n, &profile);
+    int inline_ok = profile.avg_prefix <= t->inline_max_prefix;
+
+    if (profile.sorted) {
+        sort_auto_record("sort_auto_str", &profile, SORT_AUTO_NONE, "sudah terurut");
+    } else if (profile.reversed) {
+        sort_auto_record("sort_auto_str", &profile, SORT_AUTO_REVERSE, "terurut menurun");
+        sort_auto_reverse_stable_str(arr, n);
+    } else if (profile.descent_ratio <= t->presorted_descents || profile.inversion_ratio <= t->presorted_inversions ||
+               profile.descent_ratio < t->quick_min_descents) {
+        const char *reason = profile.descent_ratio <= t->presorted_descents ||
+                             profile.inversion_ratio <= t->presorted_inversions ? "hampir terurut" : "sebagian terurut";
+        sort_auto_record("sort_auto_str", &profile, inline_ok ? SORT_AUTO_MERGE_INLINE : SORT_AUTO_MERGE, reason);
+        if (inline_ok) merge_sort_str_inline(arr, n);
+        else merge_sort_str(arr, n);
+    } else if (inline_ok) {
+        sort_auto_record("sort_auto_str", &profile, SORT_AUTO_QUICK_INLINE, "acak, prefix pendek");
+        quick_sort_str_inline(arr, n);
+    } else {
+        sort_auto_record("sort_auto_str", &profile, SORT_AUTO_MERGE, "acak, prefix panjang");
+        merge_sort_str(arr, n);
+    }
+}
+
+#endif // SORT_AUTO_H
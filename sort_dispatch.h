@@ -0,0 +1,817 @@
+#ifndef SORT_DISPATCH_H
+#define SORT_DISPATCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <limits.h>
+
+#include "sorting_algorithms.h"
+
+// Dispatch ISA hanya didukung GCC/Clang di x86; platform lain selalu scalar.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SORT_DISPATCH_X86 1
+#define SORT_KERNEL_INLINE static inline __attribute__((always_inline))
+#define SORT_TARGET(isa) __attribute__((target(isa)))
+#include <immintrin.h>
+#else
+#define SORT_DISPATCH_X86 0
+#define SORT_KERNEL_INLINE static inline
+#define SORT_TARGET(isa)
+#endif
+
+// Di bawah ukuran ini subarray diselesaikan oleh kernel sorting network.
+#define SORT_SMALL_THRESHOLD 16
+
+// === Level ISA dan Tabel Kernel ===
+
+typedef enum {
+    SORT_ISA_SCALAR = 0,
+    SORT_ISA_SSE42,
+    SORT_ISA_AVX2,
+    SORT_ISA_AVX512
+} SortIsaLevel;
+
+// Tabel kernel aktif; diisi sekali oleh sort_dispatch_init()
+typedef struct {
+    SortIsaLevel level;
+    size_t (*partition_int)(int arr[], size_t low, size_t high);
+    void (*merge_int)(int arr[], size_t l, size_t m, size_t r, int temp[]);
+    void (*small_sort_int)(int arr[], size_t n);
+} SortKernels;
+
+const char *sort_isa_name(SortIsaLevel level) {
+    switch (level) {
+        case SORT_ISA_SSE42:  return "sse4.2";
+        case SORT_ISA_AVX2:   return "avx2";
+        case SORT_ISA_AVX512: return "avx512";
+        case SORT_ISA_SCALAR:
+        default:              return "scalar";
+    }
+}
+
+// === Kernel Scalar (juga dipakai varian vektor untuk rentang pendek) ===
+
+/**
+ * @brief Partisi Lomuto tanpa cabang.
+ * @prinsip Setiap elemen selalu ditukar ke posisi i, lalu i hanya maju jika
+ *          elemen <= pivot. Tidak ada cabang yang bergantung pada data,
+ *          sehingga tidak ada branch misprediction pada input acak.
+ */
+SORT_KERNEL_INLINE size_t partition_int_body(int arr[], size_t low, size_t high) {
+    int pivot = arr[high];
+    size_t i = low;
+    for (size_t j = low; j < high; j++) {
+        int v = arr[j];
+        arr[j] = arr[i];
+        arr[i] = v;
+        i += (v <= pivot);
+    }
+    int t = arr[i]; arr[i] = arr[high]; arr[high] = t;
+    return i;
+}
+
+/**
+ * @brief Merge stabil tanpa cabang (kontrak sama dengan merge_int).
+ * @prinsip Elemen terkecil dipilih dengan conditional move dan kedua indeks
+ *          maju sesuai hasil perbandingan, bukan lewat if/else.
+ */
+SORT_KERNEL_INLINE void merge_int_body(int arr[], size_t l, size_t m, size_t r, int temp[]) {
+    size_t n1 = m - l + 1;
+    size_t i = 0, j = m + 1, k = l;
+    memcpy(temp, &arr[l], n1 * sizeof(int));
+    while (i < n1 && j <= r) {
+        int a = temp[i];
+        int b = arr[j];
+        int take_left = a <= b;
+        arr[k++] = take_left ? a : b;
+        i += take_left;
+        j += !take_left;
+    }
+    while (i < n1) arr[k++] = temp[i++];
+}
+
+/**
+ * @brief Sorting network odd-even transposition untuk n kecil.
+ * @prinsip n putaran compare-exchange min/max pada pasangan bersebelahan
+ *          (genap lalu ganjil). Urutan operasi tidak bergantung data sehingga
+ *          bebas cabang dan dapat divektorisasi oleh compiler.
+ */
+SORT_KERNEL_INLINE void small_sort_int_body(int arr[], size_t n) {
+    for (size_t round = 0; round < n; round++) {
+        for (size_t i = round & 1; i + 1 < n; i += 2) {
+            int a = arr[i];
+            int b = arr[i + 1];
+            arr[i] = a < b ? a : b;
+            arr[i + 1] = a < b ? b : a;
+        }
+    }
+}
+
+// === Varian per ISA ===
+
+size_t partition_int_scalar(int arr[], size_t low, size_t high) { return partition_int_body(arr, low, high); }
+void merge_int_scalar(int arr[], size_t l, size_t m, size_t r, int temp[]) { merge_int_body(arr, l, m, r, temp); }
+void small_sort_int_scalar(int arr[], size_t n) { small_sort_int_body(arr, n); }
+
+/**
+ * @brief Menyelesaikan merge setelah loop vektor (kontrak sama dengan merge_int).
+ * @prinsip held berisi nheld elemen terbesar yang sudah diambil (terurut),
+ *          a..a_end sisa paruh kiri (di temp) dan b..b_end sisa paruh kanan (di
+ *          arr). Ketiganya di-merge ke out; out tidak pernah melewati b karena
+ *          jumlah elemen yang tersisa di held dan a selalu sama dengan b - out.
+ */
+SORT_KERNEL_INLINE void merge_int_tail(int *out, const int *held, size_t nheld, const int *a, const int *a_end,
+                                       const int *b, const int *b_end) {
+    size_t h = 0;
+    while (h < nheld) {
+        int v = held[h];
+        int src = 0;
+        if (a < a_end && *a < v) { v = *a; src = 1; }
+        if (b < b_end && *b < v) { v = *b; src = 2; }
+        *out++ = v;
+        h += src == 0;
+        a += src == 1;
+        b += src == 2;
+    }
+    while (a < a_end && b < b_end) {
+        int x = *a;
+        int y = *b;
+        int take_left = x <= y;
+        *out++ = take_left ? x : y;
+        a += take_left;
+        b += !take_left;
+    }
+    while (a < a_end) *out++ = *a++;
+}
+
+#if SORT_DISPATCH_X86
+
+/*
+ * Kernel vektor memakai skema yang sama di setiap lebar W (4, 8, 16 int):
+ * - Partisi: 2W elemen pertama dan terakhir disimpan dulu sehingga ada ruang
+ *   2W kosong di kedua ujung. Setiap langkah membaca dua vektor dari sisi
+ *   yang ruang kosongnya lebih sedikit; lajur <= pivot dipadatkan ke depan
+ *   (LUT permutasi atau compress-store) lalu ditulis ke kiri, lajur > pivot
+ *   ke kanan. Total ruang kosong selalu 4W sehingga penulisan tidak pernah
+ *   menimpa elemen yang belum dibaca (Bramas 2017). Dua vektor per langkah
+ *   karena cabang pemilihan sisi sulit ditebak; versi satu vektor per
+ *   cabang tidak lebih cepat dari scalar pada SSE4.2.
+ * - Sorting network: bitonic sort di register; setiap tahap = permutasi
+ *   pasangan + min/max + blend lajur yang mengambil min.
+ * - Merge: bitonic merge dua vektor terurut; vektor berikutnya diambil dari
+ *   sisi yang kepalanya lebih kecil (Inoue 2007). Untuk int, urutan antar
+ *   nilai sama tidak bisa dibedakan sehingga hasilnya setara merge stabil.
+ */
+
+// LUT partisi: untuk bitmask lajur > pivot, urutan lajur <= pivot lalu lajur > pivot
+int32_t sort_partition_lut_avx2[256][8];
+uint8_t sort_partition_lut_sse42[16][16];
+
+// Mengisi LUT permutasi partisi (dipanggil sekali oleh sort_dispatch_init)
+void sort_build_partition_luts(void) {
+    for (int mask = 0; mask < 256; mask++) {
+        int k = 0;
+        for (int lane = 0; lane < 8; lane++)
+            if (!(mask & (1 << lane))) sort_partition_lut_avx2[mask][k++] = lane;
+        for (int lane = 0; lane < 8; lane++)
+            if (mask & (1 << lane)) sort_partition_lut_avx2[mask][k++] = lane;
+    }
+    for (int mask = 0; mask < 16; mask++) {
+        int k = 0;
+        for (int pass = 0; pass < 2; pass++) {
+            for (int lane = 0; lane < 4; lane++) {
+                if (((mask >> lane) & 1) != pass) continue;
+                for (int byte = 0; byte < 4; byte++) sort_partition_lut_sse42[mask][k++] = (uint8_t)(lane * 4 + byte);
+            }
+        }
+    }
+}
+
+// Sisa partisi (bagian yang belum dibaca + blok simpanan) sudah disalin ke tail; tulis dari kedua ujung
+SORT_KERNEL_INLINE size_t partition_int_finish(int arr[], size_t high, int *wl, int *wr, const int *tail, size_t count) {
+    int pivot = arr[high];
+    for (size_t i = 0; i < count; i++) {
+        int v = tail[i];
+        int le = v <= pivot;
+        *wl = v;      // Kedua posisi bebas: semua sisa data sudah di tail
+        wr[-1] = v;
+        wl += le;
+        wr -= !le;
+    }
+    size_t mid = (size_t)(wl - arr);
+    int t = arr[mid]; arr[mid] = arr[high]; arr[high] = t;
+    return mid;
+}
+
+// --- SSE4.2 (4 lajur) ---
+
+SORT_TARGET("sse4.2") static inline void partition_store_sse42(__m128i v, __m128i pv, int **wl, int **wr) {
+    int gt = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, pv)));
+    int le = 4 - __builtin_popcount((unsigned)gt);
+    v = _mm_shuffle_epi8(v, _mm_loadu_si128((const __m128i *)sort_partition_lut_sse42[gt]));
+    _mm_storeu_si128((__m128i *)*wl, v);
+    _mm_storeu_si128((__m128i *)(*wr - 4), v);
+    *wl += le;
+    *wr -= 4 - le;
+}
+
+SORT_TARGET("sse4.2") size_t partition_int_sse42(int arr[], size_t low, size_t high) {
+    if (high - low < 4 * 8) return partition_int_body(arr, low, high);
+    __m128i pv = _mm_set1_epi32(arr[high]);
+    int saved[16];
+    memcpy(saved, &arr[low], 8 * sizeof(int));
+    memcpy(saved + 8, &arr[high - 8], 8 * sizeof(int));
+    int *wl = arr + low, *wr = arr + high;
+    int *l = wl + 8, *r = wr - 8;
+    while (r - l >= 8) {
+        const int *src;
+        if (l - wl <= wr - r) {
+            src = l;
+            l += 8;
+        } else {
+            r -= 8;
+            src = r;
+        }
+        __m128i v0 = _mm_loadu_si128((const __m128i *)src);
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(src + 4));
+        partition_store_sse42(v0, pv, &wl, &wr);
+        partition_store_sse42(v1, pv, &wl, &wr);
+    }
+    int tail[8 + 16];
+    size_t rest = (size_t)(r - l);
+    memcpy(tail, l, rest * sizeof(int));
+    memcpy(tail + rest, saved, sizeof(saved));
+    return partition_int_finish(arr, high, wl, wr, tail, rest + 16);
+}
+
+// Satu tahap compare-exchange: lajur di imm16 (blend per 16 bit) mengambil min
+#define SORT_SSE42_STAGE(v, partner, imm16) do {                          \
+        __m128i p_ = (partner);                                           \
+        (v) = _mm_blend_epi16(_mm_max_epi32((v), p_), _mm_min_epi32((v), p_), (imm16)); \
+    } while (0)
+
+// Membersihkan deret bitonik 4 lajur menjadi terurut naik (jarak 2, lalu 1)
+SORT_TARGET("sse4.2") static inline __m128i bitonic_clean_sse42(__m128i v) {
+    SORT_SSE42_STAGE(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)), 0x0F);
+    SORT_SSE42_STAGE(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)), 0x33);
+    return v;
+}
+
+SORT_TARGET("sse4.2") static inline __m128i bitonic_sort_sse42(__m128i v) {
+    SORT_SSE42_STAGE(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)), 0xC3);
+    return bitonic_clean_sse42(v);
+}
+
+// lo dan hi terurut -> lo berisi 4 terkecil, hi 4 terbesar (keduanya terurut)
+SORT_TARGET("sse4.2") static inline void bitonic_merge_sse42(__m128i *lo, __m128i *hi) {
+    __m128i b = _mm_shuffle_epi32(*hi, _MM_SHUFFLE(0, 1, 2, 3));
+    __m128i mn = _mm_min_epi32(*lo, b);
+    __m128i mx = _mm_max_epi32(*lo, b);
+    *lo = bitonic_clean_sse42(mn);
+    *hi = bitonic_clean_sse42(mx);
+}
+
+SORT_TARGET("sse4.2") void merge_int_sse42(int arr[], size_t l, size_t m, size_t r, int temp[]) {
+    size_t n1 = m - l + 1, n2 = r - m;
+    if (n1 < 4 || n2 < 4) {
+        merge_int_body(arr, l, m, r, temp);
+        return;
+    }
+    memcpy(temp, &arr[l], n1 * sizeof(int));
+    const int *a = temp, *a_end = temp + n1;
+    const int *b = arr + m + 1, *b_end = arr + r + 1;
+    int *out = arr + l;
+    __m128i hi = _mm_loadu_si128((const __m128i *)a);
+    __m128i lo = _mm_loadu_si128((const __m128i *)b);
+    a += 4;
+    b += 4;
+    for (;;) {
+        bitonic_merge_sse42(&lo, &hi);
+        _mm_storeu_si128((__m128i *)out, lo);
+        out += 4;
+        int from_a = a < a_end && (b == b_end || *a <= *b);
+        if (from_a ? a_end - a < 4 : b_end - b < 4) break;
+        if (from_a) {
+            lo = _mm_loadu_si128((const __m128i *)a);
+            a += 4;
+        } else {
+            lo = _mm_loadu_si128((const __m128i *)b);
+            b += 4;
+        }
+    }
+    int held[4];
+    _mm_storeu_si128((__m128i *)held, hi);
+    merge_int_tail(out, held, 4, a, a_end, b, b_end);
+}
+
+SORT_TARGET("sse4.2") void small_sort_int_sse42(int arr[], size_t n) {
+    if (n < 2) return;
+    if (n > SORT_SMALL_THRESHOLD) {
+        small_sort_int_body(arr, n);
+        return;
+    }
+    int buf[16];
+    for (size_t i = n; i < 16; i++) buf[i] = INT_MAX; // Padding tetap di ekor setelah diurutkan
+    memcpy(buf, arr, n * sizeof(int));
+    __m128i v0 = bitonic_sort_sse42(_mm_loadu_si128((const __m128i *)&buf[0]));
+    __m128i v1 = bitonic_sort_sse42(_mm_loadu_si128((const __m128i *)&buf[4]));
+    __m128i v2 = bitonic_sort_sse42(_mm_loadu_si128((const __m128i *)&buf[8]));
+    __m128i v3 = bitonic_sort_sse42(_mm_loadu_si128((const __m128i *)&buf[12]));
+    bitonic_merge_sse42(&v0, &v1);
+    bitonic_merge_sse42(&v2, &v3);
+    // Merge 8 + 8: bandingkan dengan paruh kedua yang dibalik, lalu bersihkan jarak 4, 2, 1
+    __m128i r2 = _mm_shuffle_epi32(v3, _MM_SHUFFLE(0, 1, 2, 3));
+    __m128i r3 = _mm_shuffle_epi32(v2, _MM_SHUFFLE(0, 1, 2, 3));
+    __m128i lo0 = _mm_min_epi32(v0, r2), hi0 = _mm_max_epi32(v0, r2);
+    __m128i lo1 = _mm_min_epi32(v1, r3), hi1 = _mm_max_epi32(v1, r3);
+    v0 = bitonic_clean_sse42(_mm_min_epi32(lo0, lo1));
+    v1 = bitonic_clean_sse42(_mm_max_epi32(lo0, lo1));
+    v2 = bitonic_clean_sse42(_mm_min_epi32(hi0, hi1));
+    v3 = bitonic_clean_sse42(_mm_max_epi32(hi0, hi1));
+    _mm_storeu_si128((__m128i *)&buf[0], v0);
+    _mm_storeu_si128((__m128i *)&buf[4], v1);
+    _mm_storeu_si128((__m128i *)&buf[8], v2);
+    _mm_storeu_si128((__m128i *)&buf[12], v3);
+    memcpy(arr, buf, n * sizeof(int));
+}
+
+// --- AVX2 (8 lajur) ---
+
+SORT_TARGET("avx2") static inline void partition_store_avx2(__m256i v, __m256i pv, int **wl, int **wr) {
+    int gt = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, pv)));
+    int le = 8 - __builtin_popcount((unsigned)gt);
+    v = _mm256_permutevar8x32_epi32(v, _mm256_loadu_si256((const __m256i *)sort_partition_lut_avx2[gt]));
+    _mm256_storeu_si256((__m256i *)*wl, v);
+    _mm256_storeu_si256((__m256i *)(*wr - 8), v);
+    *wl += le;
+    *wr -= 8 - le;
+}
+
+SORT_TARGET("avx2") size_t partition_int_avx2(int arr[], size_t low, size_t high) {
+    if (high - low < 4 * 16) return partition_int_body(arr, low, high);
+    __m256i pv = _mm256_set1_epi32(arr[high]);
+    int saved[32];
+    memcpy(saved, &arr[low], 16 * sizeof(int));
+    memcpy(saved + 16, &arr[high - 16], 16 * sizeof(int));
+    int *wl = arr + low, *wr = arr + high;
+    int *l = wl + 16, *r = wr - 16;
+    while (r - l >= 16) {
+        const int *src;
+        if (l - wl <= wr - r) {
+            src = l;
+            l += 16;
+        } else {
+            r -= 16;
+            src = r;
+        }
+        __m256i v0 = _mm256_loadu_si256((const __m256i *)src);
+        __m256i v1 = _mm256_loadu_si256((const __m256i *)(src + 8));
+        partition_store_avx2(v0, pv, &wl, &wr);
+        partition_store_avx2(v1, pv, &wl, &wr);
+    }
+    int tail[16 + 32];
+    size_t rest = (size_t)(r - l);
+    memcpy(tail, l, rest * sizeof(int));
+    memcpy(tail + rest, saved, sizeof(saved));
+    return partition_int_finish(arr, high, wl, wr, tail, rest + 32);
+}
+
+// Satu tahap compare-exchange: lajur di imm8 (blend per 32 bit) mengambil min
+#define SORT_AVX2_STAGE(v, partner, imm8) do {                            \
+        __m256i p_ = (partner);                                           \
+        (v) = _mm256_blend_epi32(_mm256_max_epi32((v), p_), _mm256_min_epi32((v), p_), (imm8)); \
+    } while (0)
+
+// Membersihkan deret bitonik 8 lajur menjadi terurut naik (jarak 4, 2, 1)
+SORT_TARGET("avx2") static inline __m256i bitonic_clean_avx2(__m256i v) {
+    SORT_AVX2_STAGE(v, _mm256_permute2x128_si256(v, v, 0x01), 0x0F);
+    SORT_AVX2_STAGE(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)), 0x33);
+    SORT_AVX2_STAGE(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)), 0x55);
+    return v;
+}
+
+SORT_TARGET("avx2") static inline __m256i bitonic_sort_avx2(__m256i v) {
+    SORT_AVX2_STAGE(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)), 0x99);
+    SORT_AVX2_STAGE(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)), 0xC3);
+    SORT_AVX2_STAGE(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)), 0xA5);
+    return bitonic_clean_avx2(v);
+}
+
+// lo dan hi terurut -> lo berisi 8 terkecil, hi 8 terbesar (keduanya terurut)
+SORT_TARGET("avx2") static inline void bitonic_merge_avx2(__m256i *lo, __m256i *hi) {
+    __m256i b = _mm256_permutevar8x32_epi32(*hi, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    __m256i mn = _mm256_min_epi32(*lo, b);
+    __m256i mx = _mm256_max_epi32(*lo, b);
+    *lo = bitonic_clean_avx2(mn);
+    *hi = bitonic_clean_avx2(mx);
+}
+
+SORT_TARGET("avx2") void merge_int_avx2(int arr[], size_t l, size_t m, size_t r, int temp[]) {
+    size_t n1 = m - l + 1, n2 = r - m;
+    if (n1 < 8 || n2 < 8) {
+        merge_int_body(arr, l, m, r, temp);
+        return;
+    }
+    memcpy(temp, &arr[l], n1 * sizeof(int));
+    const int *a = temp, *a_end = temp + n1;
+    const int *b = arr + m + 1, *b_end = arr + r + 1;
+    int *out = arr + l;
+    __m256i hi = _mm256_loadu_si256((const __m256i *)a);
+    __m256i lo = _mm256_loadu_si256((const __m256i *)b);
+    a += 8;
+    b += 8;
+    for (;;) {
+        bitonic_merge_avx2(&lo, &hi);
+        _mm256_storeu_si256((__m256i *)out, lo);
+        out += 8;
+        int from_a = a < a_end && (b == b_end || *a <= *b);
+        if (from_a ? a_end - a < 8 : b_end - b < 8) break;
+        if (from_a) {
+            lo = _mm256_loadu_si256((const __m256i *)a);
+            a += 8;
+        } else {
+            lo = _mm256_loadu_si256((const __m256i *)b);
+            b += 8;
+        }
+    }
+    int held[8];
+    _mm256_storeu_si256((__m256i *)held, hi);
+    merge_int_tail(out, held, 8, a, a_end, b, b_end);
+}
+
+SORT_TARGET("avx2") void small_sort_int_avx2(int arr[], size_t n) {
+    if (n < 2) return;
+    if (n > SORT_SMALL_THRESHOLD) {
+        small_sort_int_body(arr, n);
+        return;
+    }
+    int buf[16];
+    for (size_t i = n; i < 16; i++) buf[i] = INT_MAX;
+    memcpy(buf, arr, n * sizeof(int));
+    __m256i lo = bitonic_sort_avx2(_mm256_loadu_si256((const __m256i *)&buf[0]));
+    __m256i hi = bitonic_sort_avx2(_mm256_loadu_si256((const __m256i *)&buf[8]));
+    bitonic_merge_avx2(&lo, &hi);
+    _mm256_storeu_si256((__m256i *)&buf[0], lo);
+    _mm256_storeu_si256((__m256i *)&buf[8], hi);
+    memcpy(arr, buf, n * sizeof(int));
+}
+
+// --- AVX-512 (16 lajur) ---
+
+SORT_TARGET("avx512f") static inline void partition_store_avx512(__m512i v, __m512i pv, int **wl, int **wr) {
+    __mmask16 le_mask = _mm512_cmple_epi32_mask(v, pv);
+    int le = __builtin_popcount((unsigned)le_mask);
+    _mm512_mask_compressstoreu_epi32(*wl, le_mask, v);
+    _mm512_mask_compressstoreu_epi32(*wr - (16 - le), (__mmask16)~le_mask, v);
+    *wl += le;
+    *wr -= 16 - le;
+}
+
+SORT_TARGET("avx512f") size_t partition_int_avx512(int arr[], size_t low, size_t high) {
+    if (high - low < 4 * 32) return partition_int_body(arr, low, high);
+    __m512i pv = _mm512_set1_epi32(arr[high]);
+    __m512i saved_l0 = _mm512_loadu_si512(&arr[low]);
+    __m512i saved_l1 = _mm512_loadu_si512(&arr[low + 16]);
+    __m512i saved_r0 = _mm512_loadu_si512(&arr[high - 32]);
+    __m512i saved_r1 = _mm512_loadu_si512(&arr[high - 16]);
+    int *wl = arr + low, *wr = arr + high;
+    int *l = wl + 32, *r = wr - 32;
+    while (r - l >= 32) {
+        const int *src;
+        if (l - wl <= wr - r) {
+            src = l;
+            l += 32;
+        } else {
+            r -= 32;
+            src = r;
+        }
+        __m512i v0 = _mm512_loadu_si512(src);
+        __m512i v1 = _mm512_loadu_si512(src + 16);
+        partition_store_avx512(v0, pv, &wl, &wr);
+        partition_store_avx512(v1, pv, &wl, &wr);
+    }
+    if (r - l >= 16) {
+        const int *src;
+        if (l - wl <= wr - r) {
+            src = l;
+            l += 16;
+        } else {
+            r -= 16;
+            src = r;
+        }
+        partition_store_avx512(_mm512_loadu_si512(src), pv, &wl, &wr);
+    }
+    // Compress-store menulis tepat jumlah lajurnya, jadi sisa juga bisa langsung divektorkan
+    __mmask16 rest_mask = (__mmask16)((1u << (r - l)) - 1);
+    __m512i rest = _mm512_maskz_loadu_epi32(rest_mask, l);
+    __mmask16 le_mask = _mm512_mask_cmple_epi32_mask(rest_mask, rest, pv);
+    int le = __builtin_popcount((unsigned)le_mask);
+    int gt = (int)(r - l) - le;
+    _mm512_mask_compressstoreu_epi32(wl, le_mask, rest);
+    _mm512_mask_compressstoreu_epi32(wr - gt, (__mmask16)(rest_mask & ~le_mask), rest);
+    wl += le;
+    wr -= gt;
+    partition_store_avx512(saved_l0, pv, &wl, &wr);
+    partition_store_avx512(saved_l1, pv, &wl, &wr);
+    partition_store_avx512(saved_r0, pv, &wl, &wr);
+    partition_store_avx512(saved_r1, pv, &wl, &wr);
+    size_t mid = (size_t)(wl - arr);
+    int t = arr[mid]; arr[mid] = arr[high]; arr[high] = t;
+    return mid;
+}
+
+// Satu tahap compare-exchange dengan lajur pasangan lane ^ j; lajur di mask mengambil min
+#define SORT_AVX512_STAGE(v, j, mask) do {                                \
+        __m512i p_ = _mm512_permutexvar_epi32(_mm512_xor_si512(iota, _mm512_set1_epi32(j)), (v)); \
+        (v) = _mm512_mask_min_epi32(_mm512_max_epi32((v), p_), (mask), (v), p_); \
+    } while (0)
+
+// Membersihkan deret bitonik 16 lajur menjadi terurut naik (jarak 8, 4, 2, 1)
+SORT_TARGET("avx512f") static inline __m512i bitonic_clean_avx512(__m512i v) {
+    const __m512i iota = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    SORT_AVX512_STAGE(v, 8, 0x00FF);
+    SORT_AVX512_STAGE(v, 4, 0x0F0F);
+    SORT_AVX512_STAGE(v, 2, 0x3333);
+    SORT_AVX512_STAGE(v, 1, 0x5555);
+    return v;
+}
+
+SORT_TARGET("avx512f") static inline __m512i bitonic_sort_avx512(__m512i v) {
+    const __m512i iota = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    SORT_AVX512_STAGE(v, 1, 0x9999);
+    SORT_AVX512_STAGE(v, 2, 0xC3C3);
+    SORT_AVX512_STAGE(v, 1, 0xA5A5);
+    SORT_AVX512_STAGE(v, 4, 0xF00F);
+    SORT_AVX512_STAGE(v, 2, 0xCC33);
+    SORT_AVX512_STAGE(v, 1, 0xAA55);
+    return bitonic_clean_avx512(v);
+}
+
+// lo dan hi terurut -> lo berisi 16 terkecil, hi 16 terbesar (keduanya terurut)
+SORT_TARGET("avx512f") static inline void bitonic_merge_avx512(__m512i *lo, __m512i *hi) {
+    const __m512i reverse = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    __m512i b = _mm512_permutexvar_epi32(reverse, *hi);
+    __m512i mn = _mm512_min_epi32(*lo, b);
+    __m512i mx = _mm512_max_epi32(*lo, b);
+    *lo = bitonic_clean_avx512(mn);
+    *hi = bitonic_clean_avx512(mx);
+}
+
+SORT_TARGET("avx512f") void merge_int_avx512(int arr[], size_t l, size_t m, size_t r, int temp[]) {
+    size_t n1 = m - l + 1, n2 = r - m;
+    if (n1 < 16 || n2 < 16) {
+        merge_int_body(arr, l, m, r, temp);
+        return;
+    }
+    memcpy(temp, &arr[l], n1 * sizeof(int));
+    const int *a = temp, *a_end = temp + n1;
+    const int *b = arr + m + 1, *b_end = arr + r + 1;
+    int *out = arr + l;
+    __m512i hi = _mm512_loadu_si512(a);
+    __m512i lo = _mm512_loadu_si512(b);
+    a += 16;
+    b += 16;
+    for (;;) {
+        bitonic_merge_avx512(&lo, &hi);
+        _mm512_storeu_si512(out, lo);
+        out += 16;
+        int from_a = a < a_end && (b == b_end || *a <= *b);
+        if (from_a ? a_end - a < 16 : b_end - b < 16) break;
+        if (from_a) {
+            lo = _mm512_loadu_si512(a);
+            a += 16;
+        } else {
+            lo = _mm512_loadu_si512(b);
+            b += 16;
+        }
+    }
+    int held[16];
+    _mm512_storeu_si512(held, hi);
+    merge_int_tail(out, held, 16, a, a_end, b, b_end);
+}
+
+SORT_TARGET("avx512f") void small_sort_int_avx512(int arr[], size_t n) {
+    if (n < 2) return;
+    if (n > SORT_SMALL_THRESHOLD) {
+        small_sort_int_body(arr, n);
+        return;
+    }
+    __mmask16 mask = (__mmask16)((1u << n) - 1);
+    __m512i v = _mm512_mask_loadu_epi32(_mm512_set1_epi32(INT_MAX), mask, arr);
+    _mm512_mask_storeu_epi32(arr, mask, bitonic_sort_avx512(v));
+}
+#endif
+
+SortKernels sort_kernels = {SORT_ISA_SCALAR, partition_int_scalar, merge_int_scalar, small_sort_int_scalar};
+
+// === Deteksi dan Pemilihan ===
+
+/**
+ * @brief Mendeteksi level ISA tertinggi yang didukung CPU (CPUID).
+ */
+SortIsaLevel detect_sort_isa(void) {
+#if SORT_DISPATCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SORT_ISA_AVX512;
+    if (__builtin_cpu_supports("avx2")) return SORT_ISA_AVX2;
+    if (__builtin_cpu_supports("sse4.2")) return SORT_ISA_SSE42;
+#endif
+    return SORT_ISA_SCALAR;
+}
+
+// Mengubah nama level ("scalar", "sse4.2", "avx2", "avx512") ke enum; -1 jika tidak dikenal
+int parse_sort_isa(const char *name) {
+    if (strcmp(name, "scalar") == 0) return SORT_ISA_SCALAR;
+    if (strcmp(name, "sse4.2") == 0 || strcmp(name, "sse42") == 0) return SORT_ISA_SSE42;
+    if (strcmp(name, "avx2") == 0) return SORT_ISA_AVX2;
+    if (strcmp(name, "avx512") == 0) return SORT_ISA_AVX512;
+    return -1;
+}
+
+/**
+ * @brief Memilih varian kernel sekali saat startup.
+ * @prinsip Urutan prioritas: argumen override, variabel lingkungan SORT_ISA,
+ *          lalu hasil deteksi CPUID. Override di atas kemampuan CPU
+ *          diturunkan ke level yang terdeteksi agar tidak terjadi illegal
+ *          instruction.
+ * @param override Nama level untuk dipaksa (boleh NULL).
+ * @return Level yang akhirnya dipakai.
+ */
+SortIsaLevel sort_dispatch_init(const char *override) {
+    SortIsaLevel detected = detect_sort_isa();
+    SortIsaLevel level = detected;
+    const char *requested = override ? override : getenv("SORT_ISA");
+
+    if (requested && requested[0] != '\0') {
+        int parsed = parse_sort_isa(requested);
+        if (parsed < 0) {
+            fprintf(stderr, "Warning: Level ISA '%s' tidak dikenal, memakai %s\n", requested, sort_isa_name(detected));
+        } else if ((SortIsaLevel)parsed > detected) {
+            fprintf(stderr, "Warning: CPU tidak mendukung %s, memakai %s\n", requested, sort_isa_name(detected));
+        } else {
+            level = (SortIsaLevel)parsed;
+        }
+    }
+
+#if SORT_DISPATCH_X86
+    if (level == SORT_ISA_SSE42 || level == SORT_ISA_AVX2) sort_build_partition_luts();
+#endif
+
+    sort_kernels.level = level;
+    switch (level) {
+#if SORT_DISPATCH_X86
+        case SORT_ISA_AVX512:
+            sort_kernels.partition_int = partition_int_avx512;
+            sort_kernels.merge_int = merge_int_avx512;
+            sort_kernels.small_sort_int = small_sort_int_avx512;
+            break;
+        case SORT_ISA_AVX2:
+            sort_kernels.partition_int = partition_int_avx2;
+            sort_kernels.merge_int = merge_int_avx2;
+            sort_kernels.small_sort_int = small_sort_int_avx2;
+            break;
+        case SORT_ISA_SSE42:
+            sort_kernels.partition_int = partition_int_sse42;
+            sort_kernels.merge_int = merge_int_sse42;
+            sort_kernels.small_sort_int = small_sort_int_sse42;
+            break;
+#endif
+        default:
+            sort_kernels.level = SORT_ISA_SCALAR;
+            sort_kernels.partition_int = partition_int_scalar;
+            sort_kernels.merge_int = merge_int_scalar;
+            sort_kernels.small_sort_int = small_sort_int_scalar;
+            break;
+    }
+    return sort_kernels.level;
+}
+
+// === Sort yang Memakai Kernel Terpilih ===
+
+/**
+ * @brief Memindahkan elemen < pivot ke awal [low, high] tanpa cabang.
+ * @prinsip Dipanggil jika pivot adalah nilai maksimum rentang, sehingga
+ *          semua elemen yang sama dengan pivot terkumpul di ujung kanan.
+ * @return Indeks awal deretan elemen yang sama dengan pivot.
+ */
+size_t gather_less_int(int arr[], size_t low, size_t high, int pivot) {
+    size_t i = low;
+    for (size_t j = low; j <= high; j++) {
+        int v = arr[j];
+        arr[j] = arr[i];
+        arr[i] = v;
+        i += (v < pivot);
+    }
+    return i;
+}
+
+/**
+ * @brief Rekursi Quick Sort dispatch (introsort).
+ * @prinsip Partisi memakai <=, jadi kunci yang sama dengan pivot ikut ke kiri
+ *          dan pivot lama selalu berada tepat setelah subarray kiri. Jika
+ *          pivot baru sama dengan elemen batas itu, pivot adalah nilai
+ *          maksimum subarray: semua salinannya dikumpulkan di kanan dengan
+ *          gather_less_int dan tidak diurutkan lagi. Tanpa ini input dengan
+ *          sedikit nilai unik menjadi O(n^2). Setelah depth partisi, sisa
+ *          subarray diserahkan ke heap_sort_int sehingga pola seperti
+ *          organ-pipe tetap O(n log n).
+ * @param has_bound 1 jika arr[high + 1] ada dan >= semua elemen di [low, high].
+ * @param depth Sisa kedalaman partisi sebelum beralih ke heap_sort_int.
+ */
+void quick_sort_recursive_int_dispatch(int arr[], size_t low, size_t high, int has_bound, int depth) {
+    while (high - low + 1 > SORT_SMALL_THRESHOLD) {
+        if (depth-- == 0) {
+            heap_sort_int(arr + low, high - low + 1);
+            return;
+        }
+
+        // Median-of-three dipindah ke posisi high sebagai pivot
+        size_t mid = low + (high - low) / 2;
+        if (arr[mid] < arr[low]) swap_int(&arr[mid], &arr[low]);
+        if (arr[high] < arr[low]) swap_int(&arr[high], &arr[low]);
+        if (arr[mid] < arr[high]) swap_int(&arr[mid], &arr[high]);
+
+        if (has_bound && arr[high] == arr[high + 1]) {
+            size_t eq = gather_less_int(arr, low, high, arr[high]);
+            if (eq == low) return;
+            high = eq - 1;
+            continue;
+        }
+
+        size_t pi = sort_kernels.partition_int(arr, low, high);
+
+        // Rekursi pada sisi yang lebih kecil agar kedalaman stack O(log n)
+        if (pi - low < high - pi) {
+            if (pi > low) quick_sort_recursive_int_dispatch(arr, low, pi - 1, 1, depth);
+            low = pi + 1;
+        } else {
+            quick_sort_recursive_int_dispatch(arr, pi + 1, high, has_bound, depth);
+            if (pi == low) return;
+            high = pi - 1;
+            has_bound = 1;
+        }
+    }
+    if (low < high)
+        sort_kernels.small_sort_int(arr + low, high - low + 1);
+}
+
+/**
+ * @brief Quick Sort integer yang memakai kernel hasil dispatch ISA.
+ * @prinsip Partisi dari tabel sort_kernels (vektor, atau Lomuto tanpa cabang
+ *          pada level scalar), pivot
+ *          median-of-three, kunci duplikat dan batas kedalaman ditangani
+ *          seperti introsort (lihat quick_sort_recursive_int_dispatch), dan
+ *          subarray <= SORT_SMALL_THRESHOLD diselesaikan oleh kernel sorting
+ *          network. Panggil sort_dispatch_init() dulu;
+ *          tanpa itu varian scalar yang dipakai.
+ * @param arr Array integer yang akan diurutkan.
+ * @param n Jumlah elemen dalam array.
+ */
+void quick_sort_int_dispatch(int arr[], size_t n) {
+    if (n < 2) return;
+    quick_sort_recursive_int_dispatch(arr, 0, n - 1, 0, introsort_depth_limit(n));
+}
+
+void merge_sort_recursive_int_dispatch(int arr[], size_t l, size_t r, int temp[]) {
+    if (r - l + 1 <= SORT_SMALL_THRESHOLD) {
+        sort_kernels.small_sort_int(arr + l, r - l + 1);
+        return;
+    }
+    size_t m = l + (r - l) / 2;
+    merge_sort_recursive_int_dispatch(arr, l, m, temp);
+    merge_sort_recursive_int_dispatch(arr, m + 1, r, temp);
+    if (arr[m] > arr[m + 1]) // Lewati merge jika kedua bagian sudah berurutan
+        sort_kernels.merge_int(arr, l, m, r, temp);
+}
+
+// Versi merge_sort_int_dispatch dengan buffer temp milik pemanggil (lihat merge_sort_int_with_scratch)
+void merge_sort_int_dispatch_with_scratch(int arr[], size_t n, int scratch[], size_t scratch_len) {
+    if (n < 2) return;
+    if (scratch && scratch_len >= n / 2 + 1) {
+        merge_sort_recursive_int_dispatch(arr, 0, n - 1, scratch);
+        return;
+    }
+    int *temp = (int *)malloc((n / 2 + 1) * sizeof(int));
+    if (!temp) {
+        perror("Gagal alokasi memori untuk merge sort temp");
+        return;
+    }
+    merge_sort_recursive_int_dispatch(arr, 0, n - 1, temp);
+    free(temp);
+}
+
+/**
+ * @brief Merge Sort integer yang memakai kernel hasil dispatch ISA.
+ * @prinsip Sama seperti merge_sort_int, tetapi merge (bitonic merge vektor
+ *          atau merge tanpa cabang) dan subarray kecil dari tabel sort_kernels.
+ * @param arr Array integer yang akan diurutkan.
+ * @param n Jumlah elemen dalam array.
+ */
+void merge_sort_int_dispatch(int arr[], size_t n) {
+    merge_sort_int_dispatch_with_scratch(arr, n, NULL, 0);
+}
+
+#endif // SORT_DISPATCH_H
@@ -4,6 +4,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
+#include <stdint.h>
 
 // === Helper Functions ===
 
@@ -33,9 +35,10 @@ void swap_str(char **a, char **b) {
  * @param arr Array integer yang akan diurutkan.
  * @param n Jumlah elemen dalam array.
  */
-void bubble_sort_int(int arr[], int n) {
-    int i, j;
+void bubble_sort_int(int arr[], size_t n) {
+    size_t i, j;
     int swapped;
+    if (n < 2) return; // Hindari underflow n - 1 pada size_t
     for (i = 0; i < n - 1; i++) {
         swapped = 0;
         for (j = 0; j < n - i - 1; j++) {
@@ -58,9 +61,10 @@ void bubble_sort_int(int arr[], int n) {
  * @param arr Array pointer ke string (char*) yang akan diurutkan.
  * @param n Jumlah elemen dalam array.
  */
-void bubble_sort_str(char *arr[], int n) {
-    int i, j;
+void bubble_sort_str(char *arr[], size_t n) {
+    size_t i, j;
     int swapped;
+    if (n < 2) return;
     for (i = 0; i < n - 1; i++) {
         swapped = 0;
         for (j = 0; j < n - i - 1; j++) {
@@ -86,8 +90,9 @@ void bubble_sort_str(char *arr[], int n) {
  * @param arr Array integer yang akan diurutkan.
  * @param n Jumlah elemen dalam array.
  */
-void selection_sort_int(int arr[], int n) {
-    int i, j, min_idx;
+void selection_sort_int(int arr[], size_t n) {
+    size_t i, j, min_idx;
+    if (n < 2) return; // Hindari underflow n - 1 pada size_t
     for (i = 0; i < n - 1; i++) {
         min_idx = i;
         for (j = i + 1; j < n; j++) {
@@ -108,8 +113,9 @@ void selection_sort_int(int arr[], int n) {
  * @param arr Array pointer ke string (char*) yang akan diurutkan.
  * @param n Jumlah elemen dalam array.
  */
-void selection_sort_str(char *arr[], int n) {
-    int i, j, min_idx;
+void selection_sort_str(char *arr[], size_t n) {
+    size_t i, j, min_idx;
+    if (n < 2) return;
     for (i = 0; i < n - 1; i++) {
         min_idx = i;
         for (j = i + 1; j < n; j++) {
@@ -133,18 +139,20 @@ void selection_sort_str(char *arr[], int n) {
  * @param arr Array integer yang akan diurutkan.
  * @param n Jumlah elemen dalam array.
  */
-void insertion_sort_int(int arr[], int n) {
-    int i, key, j;
+void insertion_sort_int(int arr[], size_t n) {
+    size_t i, j;
+    int key;
     for (i = 1; i < n; i++) {
         key = arr[i];
-        j = i - 1;
+        j = i;
         // Geser elemen arr[0..i-1] yang lebih besar dari key
         // ke satu posisi di depan posisi mereka saat ini
-        while (j >= 0 && arr[j] > key) {
-            arr[j + 1] = arr[j];
+        // (j menunjuk slot kosong, sehingga tidak pernah turun di bawah 0)
+        while (j > 0 && arr[j - 1] > key) {
+            arr[j] = arr[j - 1];
             j = j - 1;
         }
-        arr[j + 1] = key;
+        arr[j] = key;
     }
 }
 
@@ -157,28 +165,27 @@ void insertion_sort_int(int arr[], int n) {
  * @param arr Array pointer ke string (char*) yang akan diurutkan.
  * @param n Jumlah elemen dalam array.
  */
-void insertion_sort_str(char *arr[], int n) {
-    int i, j;
+void insertion_sort_str(char *arr[], size_t n) {
+    size_t i, j;
     char *key;
     for (i = 1; i < n; i++) {
         key = arr[i];
-        j = i - 1;
+        j = i;
         // Geser elemen arr[0..i-1] yang lebih besar dari key
-        while (j >= 0 && strcmp(arr[j], key) > 0) {
-            arr[j + 1] = arr[j];
+        while (j > 0 && strcmp(arr[j - 1], key) > 0) {
+            arr[j] = arr[j - 1];
             j = j - 1;
         }
-        arr[j + 1] = key;
+        arr[j] = key;
     }
 }
 
 // === Merge Sort ===
 
 // Helper function for merging two sorted integer subarrays
-void merge_int(int arr[], int l, int m, int r, int temp[]) {
-    int i, j, k;
-    int n1 = m - l + 1;
-    int n2 = r - m;
+void merge_int(int arr[], size_t l, size_t m, size_t r, int temp[]) {
+    size_t i, j, k;
+    size_t n1 = m - l + 1;
 
     // Salin data ke array sementara temp[]
     for (i = 0; i < n1; i++)
@@ -212,10 +219,9 @@ void merge_int(int arr[], int l, int m, int r, int temp[]) {
 
 
 // Helper function for merging two sorted string subarrays
-void merge_str(char *arr[], int l, int m, int r, char *temp[]) {
-    int i, j, k;
-    int n1 = m - l + 1;
-    int n2 = r - m;
+void merge_str(char *arr[], size_t l, size_t m, size_t r, char *temp[]) {
+    size_t i, j, k;
+    size_t n1 = m - l + 1;
 
     // Salin data bagian kiri ke array sementara temp[]
     for (i = 0; i < n1; i++)
@@ -248,9 +254,9 @@ void merge_str(char *arr[], int l, int m, int r, char *temp[]) {
 
 
 // Fungsi rekursif utama Merge Sort untuk integer
-void merge_sort_recursive_int(int arr[], int l, int r, int temp[]) {
+void merge_sort_recursive_int(int arr[], size_t l, size_t r, int temp[]) {
     if (l < r) {
-        int m = l + (r - l) / 2; // Hindari overflow untuk l+r
+        size_t m = l + (r - l) / 2; // Hindari overflow untuk l+r
         merge_sort_recursive_int(arr, l, m, temp);
         merge_sort_recursive_int(arr, m + 1, r, temp);
         merge_int(arr, l, m, r, temp);
@@ -258,9 +264,9 @@ void merge_sort_recursive_int(int arr[], int l, int r, int temp[]) {
 }
 
 // Fungsi rekursif utama Merge Sort untuk string
-void merge_sort_recursive_str(char *arr[], int l, int r, char *temp[]) {
+void merge_sort_recursive_str(char *arr[], size_t l, size_t r, char *temp[]) {
      if (l < r) {
-        int m = l + (r - l) / 2;
+        size_t m = l + (r - l) / 2;
         merge_sort_recursive_str(arr, l, m, temp);
         merge_sort_recursive_str(arr, m + 1, r, temp);
         merge_str(arr, l, m, r, temp);
@@ -268,18 +274,22 @@ void merge_sort_recursive_str(char *arr[], int l, int r, char *temp[]) {
 }
 
 /**
- * @brief Mengurutkan array integer menggunakan algoritma Merge Sort.
- * @prinsip Merge Sort adalah algoritma Divide and Conquer. Ia membagi array
- *          menjadi dua bagian secara rekursif hingga setiap subarray hanya
- *          memiliki satu elemen (yang dianggap terurut). Kemudian, ia
- *          menggabungkan (merge) subarray-subarray tersebut secara berurutan
- *          untuk menghasilkan array akhir yang terurut. Membutuhkan memori
- *          tambahan untuk proses penggabungan.
+ * @brief Merge Sort integer dengan buffer temp milik pemanggil.
+ * @prinsip Sama seperti merge_sort_int, tetapi memori kerja n/2 + 1 elemen
+ *          diambil dari `scratch` sehingga tidak ada malloc/free (dan page
+ *          fault pada buffer baru) di dalam sort. Jika scratch NULL atau
+ *          kurang dari n/2 + 1 elemen, buffer dialokasikan seperti biasa.
  * @param arr Array integer yang akan diurutkan.
  * @param n Jumlah elemen dalam array.
+ * @param scratch Buffer kerja dari pemanggil (boleh NULL).
+ * @param scratch_len Kapasitas scratch dalam elemen.
  */
-void merge_sort_int(int arr[], int n) {
+void merge_sort_int_with_scratch(int arr[], size_t n, int scratch[], size_t scratch_len) {
     if (n < 2) return; // Tidak perlu sort jika elemen < 2
+    if (scratch && scratch_len >= n / 2 + 1) {
+        merge_sort_recursive_int(arr, 0, n - 1, scratch);
+        return;
+    }
     // Alokasi memori sementara untuk proses merge (hanya butuh setengah ukuran)
     int *temp = (int *)malloc((n / 2 + 1) * sizeof(int));
     if (!temp) {
@@ -290,19 +300,16 @@ void merge_sort_int(int arr[], int n) {
     free(temp); // Bebaskan memori sementara
 }
 
-
-/**
- * @brief Mengurutkan array string menggunakan algoritma Merge Sort.
- * @prinsip Sama seperti Merge Sort untuk integer, tetapi menggunakan strcmp
- *          saat menggabungkan subarray. Menggunakan array pointer sementara.
- * @param arr Array pointer ke string (char*) yang akan diurutkan.
- * @param n Jumlah elemen dalam array.
- */
-void merge_sort_str(char *arr[], int n) {
+// Versi string dari merge_sort_int_with_scratch (scratch berisi pointer)
+void merge_sort_str_with_scratch(char *arr[], size_t n, char *scratch[], size_t scratch_len) {
     if (n < 2) return;
+    if (scratch && scratch_len >= n / 2 + 1) {
+        merge_sort_recursive_str(arr, 0, n - 1, scratch);
+        return;
+    }
     // Alokasi memori sementara untuk pointer string
     char **temp = (char **)malloc((n / 2 + 1) * sizeof(char *));
-     if (!temp) {
+    if (!temp) {
         perror("Gagal alokasi memori untuk merge sort temp string");
         return;
     }
@@ -310,58 +317,89 @@ void merge_sort_str(char *arr[], int n) {
     free(temp);
 }
 
+/**
+ * @brief Mengurutkan array integer menggunakan algoritma Merge Sort.
+ * @prinsip Merge Sort adalah algoritma Divide and Conquer. Ia membagi array
+ *          menjadi dua bagian secara rekursif hingga setiap subarray hanya
+ *          memiliki satu elemen (yang dianggap terurut). Kemudian, ia
+ *          menggabungkan (merge) subarray-subarray tersebut secara berurutan
+ *          untuk menghasilkan array akhir yang terurut. Membutuhkan memori
+ *          tambahan untuk proses penggabungan.
+ * @param arr Array integer yang akan diurutkan.
+ * @param n Jumlah elemen dalam array.
+ */
+void merge_sort_int(int arr[], size_t n) {
+    merge_sort_int_with_scratch(arr, n, NULL, 0);
+}
+
+
+/**
+ * @brief Mengurutkan array string menggunakan algoritma Merge Sort.
+ * @prinsip Sama seperti Merge Sort untuk integer, tetapi menggunakan strcmp
+ *          saat menggabungkan subarray. Menggunakan array pointer sementara.
+ * @param arr Array pointer ke string (char*) yang akan diurutkan.
+ * @param n Jumlah elemen dalam array.
+ */
+void merge_sort_str(char *arr[], size_t n) {
+    merge_sort_str_with_scratch(arr, n, NULL, 0);
+}
+
 
 // === Quick Sort ===
 
 // Helper function partition untuk Quick Sort integer
-int partition_int(int arr[], int low, int high) {
+size_t partition_int(int arr[], size_t low, size_t high) {
     int pivot = arr[high]; // Pilih pivot (elemen terakhir)
-    int i = (low - 1);   // Indeks elemen yang lebih kecil
+    size_t i = low;      // Posisi berikutnya untuk elemen yang lebih kecil
+                         // (tidak memakai low - 1 agar tidak underflow saat low = 0)
 
-    for (int j = low; j <= high - 1; j++) {
+    for (size_t j = low; j < high; j++) {
         // Jika elemen saat ini lebih kecil atau sama dengan pivot
         if (arr[j] <= pivot) {
-            i++; // Tingkatkan indeks elemen yang lebih kecil
             swap_int(&arr[i], &arr[j]);
+            i++; // Tingkatkan indeks elemen yang lebih kecil
         }
     }
-    swap_int(&arr[i + 1], &arr[high]);
-    return (i + 1);
+    swap_int(&arr[i], &arr[high]);
+    return i;
 }
 
 // Helper function partition untuk Quick Sort string
-int partition_str(char *arr[], int low, int high) {
+size_t partition_str(char *arr[], size_t low, size_t high) {
     char *pivot = arr[high]; // Pilih pivot
-    int i = (low - 1);
+    size_t i = low;
 
-    for (int j = low; j <= high - 1; j++) {
+    for (size_t j = low; j < high; j++) {
         // Jika elemen saat ini lebih kecil atau sama dengan pivot (secara leksikografis)
         if (strcmp(arr[j], pivot) <= 0) {
-            i++;
             swap_str(&arr[i], &arr[j]);
+            i++;
         }
     }
-    swap_str(&arr[i + 1], &arr[high]);
-    return (i + 1);
+    swap_str(&arr[i], &arr[high]);
+    return i;
 }
 
 // Fungsi rekursif utama Quick Sort untuk integer
-void quick_sort_recursive_int(int arr[], int low, int high) {
+void quick_sort_recursive_int(int arr[], size_t low, size_t high) {
     if (low < high) {
         // pi adalah indeks partisi, arr[pi] sekarang di posisi yang benar
-        int pi = partition_int(arr, low, high);
+        size_t pi = partition_int(arr, low, high);
 
         // Urutkan elemen secara terpisah sebelum dan sesudah partisi
-        quick_sort_recursive_int(arr, low, pi - 1);
+        // (cek pi > low agar pi - 1 tidak underflow pada size_t)
+        if (pi > low)
+            quick_sort_recursive_int(arr, low, pi - 1);
         quick_sort_recursive_int(arr, pi + 1, high);
     }
 }
 
 // Fungsi rekursif utama Quick Sort untuk string
-void quick_sort_recursive_str(char *arr[], int low, int high) {
+void quick_sort_recursive_str(char *arr[], size_t low, size_t high) {
      if (low < high) {
-        int pi = partition_str(arr, low, high);
-        quick_sort_recursive_str(arr, low, pi - 1);
+        size_t pi = partition_str(arr, low, high);
+        if (pi > low)
+            quick_sort_recursive_str(arr, low, pi - 1);
         quick_sort_recursive_str(arr, pi + 1, high);
     }
 }
@@ -378,7 +416,7 @@ void quick_sort_recursive_str(char *arr[], int low, int high) {
  * @param arr Array integer yang akan diurutkan.
  * @param n Jumlah elemen dalam array.
  */
-void quick_sort_int(int arr[], int n) {
+void quick_sort_int(int arr[], size_t n) {
     if (n < 2) return;
     quick_sort_recursive_int(arr, 0, n - 1);
 }
@@ -390,7 +428,7 @@ void quick_sort_int(int arr[], int n) {
  * @param arr Array pointer ke string (char*) yang akan diurutkan.
  * @param n Jumlah elemen dalam array.
  */
-void quick_sort_str(char *arr[], int n) {
+void quick_sort_str(char *arr[], size_t n) {
      if (n < 2) return;
     quick_sort_recursive_str(arr, 0, n - 1);
 }
@@ -398,6 +436,33 @@ void quick_sort_str(char *arr[], int n) {
 
 // === Shell Sort ===
 
+// Satu pass insertion sort dengan jarak h (satu langkah Shell Sort)
+void shell_gap_pass_int(int arr[], size_t n, size_t h) {
+    for (size_t i = h; i < n; i++) {
+        // Ambil elemen arr[i] untuk disisipkan
+        int temp = arr[i];
+        size_t j;
+        // Geser elemen-elemen sebelumnya yang berjarak h yang lebih besar
+        for (j = i; j >= h && arr[j - h] > temp; j -= h) {
+            arr[j] = arr[j - h];
+        }
+        // Letakkan temp (arr[i] asli) pada lokasi yang benar
+        arr[j] = temp;
+    }
+}
+
+// Satu pass insertion sort dengan jarak h untuk string
+void shell_gap_pass_str(char *arr[], size_t n, size_t h) {
+    for (size_t i = h; i < n; i++) {
+        char *temp = arr[i]; // Simpan pointer string
+        size_t j;
+        for (j = i; j >= h && strcmp(arr[j - h], temp) > 0; j -= h) {
+            arr[j] = arr[j - h]; // Geser pointer
+        }
+        arr[j] = temp; // Sisipkan pointer
+    }
+}
+
 /**
  * @brief Mengurutkan array integer menggunakan algoritma Shell Sort.
  * @prinsip Shell Sort adalah perbaikan dari Insertion Sort. Ia membandingkan
@@ -410,27 +475,17 @@ void quick_sort_str(char *arr[], int n) {
  * @param arr Array integer yang akan diurutkan.
  * @param n Jumlah elemen dalam array.
  */
-void shell_sort_int(int arr[], int n) {
+void shell_sort_int(int arr[], size_t n) {
     // Mulai dengan gap besar, lalu kurangi gap
     // Menggunakan Knuth's sequence: h = 3*h + 1 (..., 1, 4, 13, 40, ...)
-    int h = 1;
+    size_t h = 1;
     while (h < n / 3) {
         h = 3 * h + 1;
     }
 
     while (h >= 1) {
         // Lakukan insertion sort untuk gap ini
-        for (int i = h; i < n; i++) {
-            // Ambil elemen arr[i] untuk disisipkan
-            int temp = arr[i];
-            int j;
-            // Geser elemen-elemen sebelumnya yang berjarak h yang lebih besar
-            for (j = i; j >= h && arr[j - h] > temp; j -= h) {
-                arr[j] = arr[j - h];
-            }
-            // Letakkan temp (arr[i] asli) pada lokasi yang benar
-            arr[j] = temp;
-        }
+        shell_gap_pass_int(arr, n, h);
         // Hitung gap berikutnya
         h = h / 3;
     }
@@ -444,23 +499,1737 @@ void shell_sort_int(int arr[], int n) {
  * @param arr Array pointer ke string (char*) yang akan diurutkan.
  * @param n Jumlah elemen dalam array.
  */
-void shell_sort_str(char *arr[], int n) {
-    int h = 1;
+void shell_sort_str(char *arr[], size_t n) {
+    size_t h = 1;
     while (h < n / 3) {
         h = 3 * h + 1;
     }
 
     while (h >= 1) {
-        for (int i = h; i < n; i++) {
-            char *temp = arr[i]; // Simpan pointer string
-            int j;
-            for (j = i; j >= h && strcmp(arr[j - h], temp) > 0; j -= h) {
-                arr[j] = arr[j - h]; // Geser pointer
+        shell_gap_pass_str(arr, n, h);
+        h = h / 3;
+    }
+}
+
+// === Heap Sort (fallback introsort) ===
+
+// Menurunkan arr[root] ke posisinya di max-heap berukuran n
+void sift_down_int(int arr[], size_t root, size_t n) {
+    int value = arr[root];
+    size_t child;
+    while ((child = 2 * root + 1) < n) {
+        if (child + 1 < n && arr[child + 1] > arr[child]) child++;
+        if (arr[child] <= value) break;
+        arr[root] = arr[child];
+        root = child;
+    }
+    arr[root] = value;
+}
+
+/**
+ * @brief Mengurutkan array integer menggunakan Heap Sort.
+ * @prinsip Array disusun menjadi max-heap, lalu elemen terbesar (akar)
+ *          berulang kali ditukar ke akhir dan heap diperbaiki. O(n log n)
+ *          untuk input apapun tanpa memori tambahan, sehingga dipakai sebagai
+ *          fallback Quick Sort saat rekursi terlalu dalam (introsort).
+ * @param arr Array integer yang akan diurutkan.
+ * @param n Jumlah elemen dalam array.
+ */
+void heap_sort_int(int arr[], size_t n) {
+    if (n < 2) return;
+    for (size_t i = n / 2; i-- > 0;)
+        sift_down_int(arr, i, n);
+    for (size_t end = n - 1; end > 0; end--) {
+        swap_int(&arr[0], &arr[end]);
+        sift_down_int(arr, 0, end);
+    }
+}
+
+// Batas kedalaman partisi introsort: 2 * floor(log2(n))
+int introsort_depth_limit(size_t n) {
+    int depth = 0;
+    while (n > 1) {
+        n >>= 1;
+        depth += 2;
+    }
+    return depth;
+}
+
+// === Counting Sort (rentang kunci kecil) ===
+
+/**
+ * @brief Mengurutkan array integer dengan Counting Sort jika rentang nilainya kecil.
+ * @prinsip Satu pass mencari min/max, satu pass menghitung kemunculan setiap
+ *          nilai di array counts[max - min + 1], lalu array ditulis ulang dari
+ *          counts secara berurutan. Tidak ada perbandingan antar elemen, biaya
+ *          O(n + rentang). Hanya layak jika rentang tidak jauh lebih besar dari n.
+ * @param arr Array integer yang akan diurutkan.
+ * @param n Jumlah elemen dalam array.
+ * @param max_range Rentang (max - min + 1) terbesar yang diizinkan.
+ * @return 1 jika terurut, 0 jika rentang melebihi max_range atau alokasi gagal
+ *         (arr tidak diubah).
+ */
+int counting_sort_int(int arr[], size_t n, size_t max_range) {
+    if (n < 2) return 1;
+    int min = arr[0], max = arr[0];
+    for (size_t i = 1; i < n; i++) {
+        if (arr[i] < min) min = arr[i];
+        if (arr[i] > max) max = arr[i];
+    }
+    uint64_t range = (uint64_t)((int64_t)max - min) + 1;
+    if (range > max_range) return 0;
+    size_t *counts = (size_t *)calloc((size_t)range, sizeof(size_t));
+    if (!counts) {
+        perror("Gagal alokasi memori untuk counting sort");
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++) counts[(size_t)((int64_t)arr[i] - min)]++;
+    size_t pos = 0;
+    for (size_t v = 0; v < (size_t)range; v++) {
+        int value = (int)((int64_t)min + (int64_t)v);
+        for (size_t c = counts[v]; c > 0; c--) arr[pos++] = value;
+    }
+    free(counts);
+    return 1;
+}
+
+// === Block Merge Sort (stabil, memori tambahan O(1)) ===
+
+// Ukuran buffer stack (jumlah elemen) untuk block_merge_int/str tanpa scratch.
+#define BLOCK_MERGE_INTERNAL_BUFFER 256
+
+// Membalik urutan arr[first..last) (dipakai untuk rotasi)
+void reverse_range_int(int arr[], size_t first, size_t last) {
+    while (first + 1 < last) {
+        last--;
+        swap_int(&arr[first], &arr[last]);
+        first++;
+    }
+}
+
+void reverse_range_str(char *arr[], size_t first, size_t last) {
+    while (first + 1 < last) {
+        last--;
+        swap_str(&arr[first], &arr[last]);
+        first++;
+    }
+}
+
+// Menukar blok arr[first..middle) dan arr[middle..last) di tempat (tiga kali reverse)
+void rotate_int(int arr[], size_t first, size_t middle, size_t last) {
+    reverse_range_int(arr, first, middle);
+    reverse_range_int(arr, middle, last);
+    reverse_range_int(arr, first, last);
+}
+
+void rotate_str(char *arr[], size_t first, size_t middle, size_t last) {
+    reverse_range_str(arr, first, middle);
+    reverse_range_str(arr, middle, last);
+    reverse_range_str(arr, first, last);
+}
+
+// Posisi pertama di arr[first..last) dengan arr[i] >= value
+size_t lower_bound_int(const int arr[], size_t first, size_t last, int value) {
+    while (first < last) {
+        size_t mid = first + (last - first) / 2;
+        if (arr[mid] < value) first = mid + 1;
+        else last = mid;
+    }
+    return first;
+}
+
+// Posisi pertama di arr[first..last) dengan arr[i] > value
+size_t upper_bound_int(const int arr[], size_t first, size_t last, int value) {
+    while (first < last) {
+        size_t mid = first + (last - first) / 2;
+        if (arr[mid] <= value) first = mid + 1;
+        else last = mid;
+    }
+    return first;
+}
+
+size_t lower_bound_str(char *const arr[], size_t first, size_t last, const char *value) {
+    while (first < last) {
+        size_t mid = first + (last - first) / 2;
+        if (strcmp(arr[mid], value) < 0) first = mid + 1;
+        else last = mid;
+    }
+    return first;
+}
+
+size_t upper_bound_str(char *const arr[], size_t first, size_t last, const char *value) {
+    while (first < last) {
+        size_t mid = first + (last - first) / 2;
+        if (strcmp(arr[mid], value) <= 0) first = mid + 1;
+        else last = mid;
+    }
+    return first;
+}
+
+/**
+ * @brief Menggabungkan arr[first..middle) dan arr[middle..last) secara stabil
+ *        memakai buffer berukuran terbatas.
+ * @prinsip Jika salah satu sisi muat di buffer, sisi itu disalin lalu di-merge
+ *          biasa (maju untuk sisi kiri, mundur untuk sisi kanan). Jika tidak,
+ *          sisi yang lebih panjang dibelah di tengah, titik potong di sisi lain
+ *          dicari dengan binary search, kedua blok tengah ditukar dengan rotasi,
+ *          lalu dua merge yang lebih kecil diselesaikan (SymMerge). Kedalaman
+ *          rekursi O(log n) karena sisi terpanjang selalu dibelah dua.
+ */
+void block_merge_int(int arr[], size_t first, size_t middle, size_t last, int buf[], size_t buf_len) {
+    while (first < middle && middle < last) {
+        size_t len1 = middle - first;
+        size_t len2 = last - middle;
+
+        // Sudah terurut, tidak perlu merge
+        if (arr[middle - 1] <= arr[middle])
+            return;
+
+        if (len1 <= buf_len) {
+            // Salin sisi kiri ke buffer, merge maju
+            size_t i = 0, j = middle, k = first;
+            memcpy(buf, &arr[first], len1 * sizeof(int));
+            while (i < len1 && j < last) {
+                if (buf[i] <= arr[j]) arr[k++] = buf[i++];
+                else arr[k++] = arr[j++];
             }
-            arr[j] = temp; // Sisipkan pointer
+            while (i < len1) arr[k++] = buf[i++];
+            return;
         }
-        h = h / 3;
+        if (len2 <= buf_len) {
+            // Salin sisi kanan ke buffer, merge mundur (ambil kanan jika sama agar stabil)
+            size_t i = len2, j = middle, k = last;
+            memcpy(buf, &arr[middle], len2 * sizeof(int));
+            while (i > 0 && j > first) {
+                if (arr[j - 1] > buf[i - 1]) arr[--k] = arr[--j];
+                else arr[--k] = buf[--i];
+            }
+            while (i > 0) arr[--k] = buf[--i];
+            return;
+        }
+
+        size_t cut1, cut2;
+        if (len1 > len2) {
+            cut1 = first + len1 / 2;
+            cut2 = lower_bound_int(arr, middle, last, arr[cut1]);
+        } else {
+            cut2 = middle + len2 / 2;
+            cut1 = upper_bound_int(arr, first, middle, arr[cut2]);
+        }
+        rotate_int(arr, cut1, middle, cut2);
+        size_t new_middle = cut1 + (cut2 - middle);
+
+        // Rekursi pada bagian yang lebih kecil, iterasi pada sisanya
+        if ((new_middle - first) < (last - new_middle)) {
+            block_merge_int(arr, first, cut1, new_middle, buf, buf_len);
+            first = new_middle;
+            middle = cut2;
+        } else {
+            block_merge_int(arr, new_middle, cut2, last, buf, buf_len);
+            last = new_middle;
+            middle = cut1;
+        }
+    }
+}
+
+// Versi string dari block_merge_int (membandingkan dengan strcmp)
+void block_merge_str(char *arr[], size_t first, size_t middle, size_t last, char *buf[], size_t buf_len) {
+    while (first < middle && middle < last) {
+        size_t len1 = middle - first;
+        size_t len2 = last - middle;
+
+        if (strcmp(arr[middle - 1], arr[middle]) <= 0)
+            return;
+
+        if (len1 <= buf_len) {
+            size_t i = 0, j = middle, k = first;
+            memcpy(buf, &arr[first], len1 * sizeof(char *));
+            while (i < len1 && j < last) {
+                if (strcmp(buf[i], arr[j]) <= 0) arr[k++] = buf[i++];
+                else arr[k++] = arr[j++];
+            }
+            while (i < len1) arr[k++] = buf[i++];
+            return;
+        }
+        if (len2 <= buf_len) {
+            size_t i = len2, j = middle, k = last;
+            memcpy(buf, &arr[middle], len2 * sizeof(char *));
+            while (i > 0 && j > first) {
+                if (strcmp(arr[j - 1], buf[i - 1]) > 0) arr[--k] = arr[--j];
+                else arr[--k] = buf[--i];
+            }
+            while (i > 0) arr[--k] = buf[--i];
+            return;
+        }
+
+        size_t cut1, cut2;
+        if (len1 > len2) {
+            cut1 = first + len1 / 2;
+            cut2 = lower_bound_str(arr, middle, last, arr[cut1]);
+        } else {
+            cut2 = middle + len2 / 2;
+            cut1 = upper_bound_str(arr, first, middle, arr[cut2]);
+        }
+        rotate_str(arr, cut1, middle, cut2);
+        size_t new_middle = cut1 + (cut2 - middle);
+
+        if ((new_middle - first) < (last - new_middle)) {
+            block_merge_str(arr, first, cut1, new_middle, buf, buf_len);
+            first = new_middle;
+            middle = cut2;
+        } else {
+            block_merge_str(arr, new_middle, cut2, last, buf, buf_len);
+            last = new_middle;
+            middle = cut1;
+        }
+    }
+}
+
+/**
+ * @brief Membangkitkan Block Merge Sort di tempat (block-selection merge ala
+ *        GrailSort) untuk satu tipe elemen.
+ * @prinsip Stabil, O(n log n) perbandingan dan pemindahan, memori tambahan O(1):
+ *          1. Kumpulkan hingga sqrt(n) + n/sqrt(n) kemunculan pertama nilai
+ *             berbeda ke awal array dengan rotasi (block_collect_keys). Sebagian
+ *             menjadi tag blok (keys), sisanya buffer internal sepanjang satu blok.
+ *             Karena semuanya berbeda, urutannya boleh diacak selama merge lalu
+ *             dipulihkan dengan insertion sort di akhir tanpa merusak stabilitas.
+ *          2. Bangun run awal sepanjang buffer dengan merge biasa yang menukar
+ *             elemen dengan buffer (block_build_runs).
+ *          3. Untuk setiap pasangan run: potong menjadi blok sepanjang buffer,
+ *             urutkan blok dengan selection sort berdasarkan elemen pertamanya
+ *             (tag key memutus seri agar blok run kiri tetap di depan), lalu
+ *             gabungkan blok bertetangga yang berasal dari run berbeda secara
+ *             lokal memakai buffer (block_combine / block_merge_blocks).
+ *          4. Urutkan kembali keys + buffer, lalu gabungkan ke data dengan merge
+ *             rotasi (biayanya O(n) karena panjang keys O(sqrt n)).
+ *          Jika nilai berbeda kurang dari yang dibutuhkan, buffer ditiadakan dan
+ *          merge lokal memakai rotasi; dengan kurang dari 4 nilai berbeda dipakai
+ *          merge rotasi bottom-up (block_lazy_sort), yang linear per tingkat
+ *          karena jumlah rotasi dibatasi oleh jumlah nilai berbeda.
+ * @param suffix Akhiran nama fungsi yang dibangkitkan (block_merge_sort_in_place_##suffix).
+ * @param type Tipe elemen.
+ * @param CMP Perbandingan dua nilai bertipe `type`: negatif, 0, atau positif.
+ */
+#define DEFINE_BLOCK_MERGE_SORT(suffix, type, CMP)                                                   \
+void block_swap_##suffix(type *a, type *b, ptrdiff_t n) {                                            \
+    while (n-- > 0) {                                                                                \
+        type t = *a;                                                                                 \
+        *a++ = *b;                                                                                   \
+        *b++ = t;                                                                                    \
+    }                                                                                                \
+}                                                                                                    \
+                                                                                                     \
+/* Menukar a[0..l1) dan a[l1..l1+l2) dengan pertukaran blok */                                       \
+void block_rotate_##suffix(type *a, ptrdiff_t l1, ptrdiff_t l2) {                                    \
+    while (l1 > 0 && l2 > 0) {                                                                       \
+        if (l1 <= l2) {                                                                              \
+            block_swap_##suffix(a, a + l1, l1);                                                      \
+            a += l1;                                                                                 \
+            l2 -= l1;                                                                                \
+        } else {                                                                                     \
+            block_swap_##suffix(a + (l1 - l2), a + l1, l2);                                          \
+            l1 -= l2;                                                                                \
+        }                                                                                            \
+    }                                                                                                \
+}                                                                                                    \
+                                                                                                     \
+/* Posisi pertama di a[0..len) dengan a[i] >= key */                                                 \
+ptrdiff_t block_search_left_##suffix(type *a, ptrdiff_t len, type key) {                             \
+    ptrdiff_t lo = -1, hi = len;                                                                     \
+    while (lo < hi - 1) {                                                                            \
+        ptrdiff_t mid = lo + ((hi - lo) >> 1);                                                       \
+        if (CMP(a[mid], key) >= 0) hi = mid;                                                         \
+        else lo = mid;                                                                               \
+    }                                                                                                \
+    return hi;                                                                                       \
+}                                                                                                    \
+                                                                                                     \
+/* Posisi pertama di a[0..len) dengan a[i] > key */                                                  \
+ptrdiff_t block_search_right_##suffix(type *a, ptrdiff_t len, type key) {                            \
+    ptrdiff_t lo = -1, hi = len;                                                                     \
+    while (lo < hi - 1) {                                                                            \
+        ptrdiff_t mid = lo + ((hi - lo) >> 1);                                                       \
+        if (CMP(a[mid], key) > 0) hi = mid;                                                          \
+        else lo = mid;                                                                               \
+    }                                                                                                \
+    return hi;                                                                                       \
+}                                                                                                    \
+                                                                                                     \
+void block_insertion_sort_##suffix(type *a, ptrdiff_t len) {                                         \
+    for (ptrdiff_t i = 1; i < len; i++) {                                                            \
+        type x = a[i];                                                                               \
+        ptrdiff_t j = i;                                                                             \
+        while (j > 0 && CMP(x, a[j - 1]) < 0) {                                                      \
+            a[j] = a[j - 1];                                                                         \
+            j--;                                                                                     \
+        }                                                                                            \
+        a[j] = x;                                                                                    \
+    }                                                                                                \
+}                                                                                                    \
+                                                                                                     \
+/* Memindahkan hingga nkeys kemunculan pertama nilai berbeda ke awal (terurut); return jumlahnya */  \
+ptrdiff_t block_collect_keys_##suffix(type *arr, ptrdiff_t len, ptrdiff_t nkeys) {                   \
+    ptrdiff_t h = 1, h0 = 0, u = 1;                                                                  \
+    while (u < len && h < nkeys) {                                                                   \
+        ptrdiff_t r = block_search_left_##suffix(arr + h0, h, arr[u]);                               \
+        if (r == h || CMP(arr[u], arr[h0 + r]) != 0) {                                               \
+            block_rotate_##suffix(arr + h0, h, u - (h0 + h));                                        \
+            h0 = u - h;                                                                              \
+            block_rotate_##suffix(arr + (h0 + r), h - r, 1);                                         \
+            h++;                                                                                     \
+        }                                                                                            \
+        u++;                                                                                         \
+    }                                                                                                \
+    block_rotate_##suffix(arr, h0, h);                                                               \
+    return h;                                                                                        \
+}                                                                                                    \
+                                                                                                     \
+/* Merge stabil arr[0..len1) dan arr[len1..len1+len2) tanpa buffer (rotasi + binary search) */       \
+void block_merge_rotate_##suffix(type *arr, ptrdiff_t len1, ptrdiff_t len2) {                        \
+    if (len1 < len2) {                                                                               \
+        while (len1 > 0) {                                                                           \
+            ptrdiff_t h = block_search_left_##suffix(arr + len1, len2, arr[0]);                      \
+            if (h != 0) {                                                                            \
+                block_rotate_##suffix(arr, len1, h);                                                 \
+                arr += h;                                                                            \
+                len2 -= h;                                                                           \
+            }                                                                                        \
+            if (len2 == 0) break;                                                                    \
+            do {                                                                                     \
+                arr++;                                                                               \
+                len1--;                                                                              \
+            } while (len1 > 0 && CMP(arr[0], arr[len1]) <= 0);                                       \
+        }                                                                                            \
+    } else {                                                                                         \
+        while (len2 > 0) {                                                                           \
+            ptrdiff_t h = block_search_right_##suffix(arr, len1, arr[len1 + len2 - 1]);              \
+            if (h != len1) {                                                                         \
+                block_rotate_##suffix(arr + h, len1 - h, len2);                                      \
+                len1 = h;                                                                            \
+            }                                                                                        \
+            if (len1 == 0) break;                                                                    \
+            do {                                                                                     \
+                len2--;                                                                              \
+            } while (len2 > 0 && CMP(arr[len1 - 1], arr[len1 + len2 - 1]) <= 0);                     \
+        }                                                                                            \
+    }                                                                                                \
+}                                                                                                    \
+                                                                                                     \
+/* Merge arr[0..l1) + arr[l1..l1+l2) ke arr[m..), buffer di arr[m..0) (m < 0) berpindah ke ekor */   \
+void block_merge_left_##suffix(type *arr, ptrdiff_t l1, ptrdiff_t l2, ptrdiff_t m) {                 \
+    ptrdiff_t p0 = 0, p1 = l1;                                                                       \
+    type t;                                                                                          \
+    l2 += l1;                                                                                        \
+    while (p1 < l2) {                                                                                \
+        if (p0 == l1 || CMP(arr[p0], arr[p1]) > 0) {                                                 \
+            t = arr[m]; arr[m++] = arr[p1]; arr[p1++] = t;                                           \
+        } else {                                                                                     \
+            t = arr[m]; arr[m++] = arr[p0]; arr[p0++] = t;                                           \
+        }                                                                                            \
+    }                                                                                                \
+    if (m != p0) block_swap_##suffix(arr + m, arr + p0, l1 - p0);                                    \
+}                                                                                                    \
+                                                                                                     \
+/* Cermin block_merge_left: hasil di arr[m..m+l1+l2), buffer sesudah data (m > 0) pindah ke depan */ \
+void block_merge_right_##suffix(type *arr, ptrdiff_t l1, ptrdiff_t l2, ptrdiff_t m) {                \
+    ptrdiff_t p0 = l1 + l2 + m - 1, p2 = l1 + l2 - 1, p1 = l1 - 1;                                   \
+    type t;                                                                                          \
+    while (p1 >= 0) {                                                                                \
+        if (p2 < l1 || CMP(arr[p1], arr[p2]) > 0) {                                                  \
+            t = arr[p0]; arr[p0--] = arr[p1]; arr[p1--] = t;                                         \
+        } else {                                                                                     \
+            t = arr[p0]; arr[p0--] = arr[p2]; arr[p2--] = t;                                         \
+        }                                                                                            \
+    }                                                                                                \
+    if (p2 != p0) {                                                                                  \
+        while (p2 >= l1) {                                                                           \
+            t = arr[p0]; arr[p0--] = arr[p2]; arr[p2--] = t;                                         \
+        }                                                                                            \
+    }                                                                                                \
+}                                                                                                    \
+                                                                                                     \
+/* Merge lokal sisa run (*len1, asal *origin) dengan blok berikut; buffer lbuf tepat sebelum arr */  \
+void block_smart_merge_##suffix(type *arr, ptrdiff_t *len1, int *origin, ptrdiff_t len2, ptrdiff_t lbuf) { \
+    ptrdiff_t p0 = -lbuf, p1 = 0, p2 = *len1, q1 = p2, q2 = p2 + len2;                               \
+    int left_wins_tie = *origin == 0; /* Blok run kiri menang saat nilai sama */                     \
+    type t;                                                                                          \
+    while (p1 < q1 && p2 < q2) {                                                                     \
+        int c = CMP(arr[p1], arr[p2]);                                                               \
+        if (c < 0 || (c == 0 && left_wins_tie)) {                                                    \
+            t = arr[p0]; arr[p0++] = arr[p1]; arr[p1++] = t;                                         \
+        } else {                                                                                     \
+            t = arr[p0]; arr[p0++] = arr[p2]; arr[p2++] = t;                                         \
+        }                                                                                            \
+    }                                                                                                \
+    if (p1 < q1) {                                                                                   \
+        *len1 = q1 - p1;                                                                             \
+        while (p1 < q1) {                                                                            \
+            q1--; q2--;                                                                              \
+            t = arr[q1]; arr[q1] = arr[q2]; arr[q2] = t;                                             \
+        }                                                                                            \
+    } else {                                                                                         \
+        *len1 = q2 - p2;                                                                             \
+        *origin = 1 - *origin;                                                                       \
+    }                                                                                                \
+}                                                                                                    \
+                                                                                                     \
+/* Sama seperti block_smart_merge tetapi tanpa buffer (rotasi) */                                    \
+void block_smart_merge_rotate_##suffix(type *arr, ptrdiff_t *len1_io, int *origin, ptrdiff_t len2) { \
+    ptrdiff_t len1 = *len1_io;                                                                       \
+    int left_wins_tie = *origin == 0;                                                                \
+    if (len2 == 0) return;                                                                           \
+    if (len1 > 0 && (left_wins_tie ? CMP(arr[len1 - 1], arr[len1]) > 0                               \
+                                   : CMP(arr[len1 - 1], arr[len1]) >= 0)) {                          \
+        while (len1 > 0) {                                                                           \
+            ptrdiff_t h = left_wins_tie ? block_search_left_##suffix(arr + len1, len2, arr[0])       \
+                                        : block_search_right_##suffix(arr + len1, len2, arr[0]);     \
+            if (h != 0) {                                                                            \
+                block_rotate_##suffix(arr, len1, h);                                                 \
+                arr += h;                                                                            \
+                len2 -= h;                                                                           \
+            }                                                                                        \
+            if (len2 == 0) {                                                                         \
+                *len1_io = len1;                                                                     \
+                return;                                                                              \
+            }                                                                                        \
+            do {                                                                                     \
+                arr++;                                                                               \
+                len1--;                                                                              \
+            } while (len1 > 0 && (left_wins_tie ? CMP(arr[0], arr[len1]) <= 0                        \
+                                                : CMP(arr[0], arr[len1]) < 0));                      \
+        }                                                                                            \
+    }                                                                                                \
+    *len1_io = len2;                                                                                 \
+    *origin = 1 - *origin;                                                                           \
+}                                                                                                    \
+                                                                                                     \
+/* Menggabungkan blok-blok yang sudah diurutkan block_combine: blok bertetangga dari run             \
+   berbeda di-merge lokal, blok dari run yang sama cukup digeser ke posisi buffer */                 \
+void block_merge_blocks_##suffix(type *keys, type midkey, type *arr, ptrdiff_t nblock, ptrdiff_t lblock, \
+                                 int havebuf, ptrdiff_t nblock2, ptrdiff_t llast) {                  \
+    ptrdiff_t prest, lrest, pidx;                                                                    \
+    int frest;                                                                                       \
+    if (nblock == 0) {                                                                               \
+        ptrdiff_t l = nblock2 * lblock;                                                              \
+        if (havebuf) block_merge_left_##suffix(arr, l, llast, -lblock);                              \
+        else block_merge_rotate_##suffix(arr, l, llast);                                             \
+        return;                                                                                      \
+    }                                                                                                \
+    lrest = lblock;                                                                                  \
+    frest = CMP(keys[0], midkey) < 0 ? 0 : 1;                                                        \
+    pidx = lblock;                                                                                   \
+    for (ptrdiff_t cidx = 1; cidx < nblock; cidx++, pidx += lblock) {                                \
+        int fnext = CMP(keys[cidx], midkey) < 0 ? 0 : 1;                                             \
+        prest = pidx - lrest;                                                                        \
+        if (fnext == frest) {                                                                        \
+            if (havebuf) block_swap_##suffix(arr + prest - lblock, arr + prest, lrest);              \
+            lrest = lblock;                                                                          \
+        } else if (havebuf) {                                                                        \
+            block_smart_merge_##suffix(arr + prest, &lrest, &frest, lblock, lblock);                 \
+        } else {                                                                                     \
+            block_smart_merge_rotate_##suffix(arr + prest, &lrest, &frest, lblock);                  \
+        }                                                                                            \
+    }                                                                                                \
+    prest = pidx - lrest;                                                                            \
+    if (llast) {                                                                                     \
+        if (frest) {                                                                                 \
+            if (havebuf) block_swap_##suffix(arr + prest - lblock, arr + prest, lrest);              \
+            prest = pidx;                                                                            \
+            lrest = lblock * nblock2;                                                                \
+        } else {                                                                                     \
+            lrest += lblock * nblock2;                                                               \
+        }                                                                                            \
+        if (havebuf) block_merge_left_##suffix(arr + prest, lrest, llast, -lblock);                  \
+        else block_merge_rotate_##suffix(arr + prest, lrest, llast);                                 \
+    } else if (havebuf) {                                                                            \
+        block_swap_##suffix(arr + prest, arr + (prest - lblock), lrest);                             \
+    }                                                                                                \
+}                                                                                                    \
+                                                                                                     \
+/* Membangun run terurut sepanjang 2*k di arr[0..len) memakai buffer k elemen tepat sebelum arr */   \
+void block_build_runs_##suffix(type *arr, ptrdiff_t len, ptrdiff_t k) {                              \
+    ptrdiff_t h, p0, rest, restk, p;                                                                 \
+    type t;                                                                                          \
+    for (ptrdiff_t m = 1; m < len; m += 2) {                                                         \
+        ptrdiff_t u = CMP(arr[m - 1], arr[m]) > 0 ? 1 : 0;                                           \
+        t = arr[m - 3]; arr[m - 3] = arr[m - 1 + u]; arr[m - 1 + u] = t;                             \
+        t = arr[m - 2]; arr[m - 2] = arr[m - u]; arr[m - u] = t;                                     \
+    }                                                                                                \
+    if (len % 2) {                                                                                   \
+        t = arr[len - 1]; arr[len - 1] = arr[len - 3]; arr[len - 3] = t;                             \
+    }                                                                                                \
+    arr -= 2;                                                                                        \
+    for (h = 2; h < k; h *= 2) {                                                                     \
+        p0 = 0;                                                                                      \
+        while (p0 <= len - 2 * h) {                                                                  \
+            block_merge_left_##suffix(arr + p0, h, h, -h);                                           \
+            p0 += 2 * h;                                                                             \
+        }                                                                                            \
+        rest = len - p0;                                                                             \
+        if (rest > h) block_merge_left_##suffix(arr + p0, h, rest - h, -h);                          \
+        else block_rotate_##suffix(arr + (p0 - h), h, rest);                                         \
+        arr -= h;                                                                                    \
+    }                                                                                                \
+    /* Buffer kini di ekor; merge mundur mengembalikannya ke depan data */                           \
+    restk = len % (2 * k);                                                                           \
+    p = len - restk;                                                                                 \
+    if (restk <= k) block_rotate_##suffix(arr + p, restk, k);                                        \
+    else block_merge_right_##suffix(arr + p, k, restk - k, k);                                       \
+    while (p > 0) {                                                                                  \
+        p -= 2 * k;                                                                                  \
+        block_merge_right_##suffix(arr + p, k, k, k);                                                \
+    }                                                                                                \
+}                                                                                                    \
+                                                                                                     \
+/* Merge sort bottom-up hanya dengan rotasi (jalur jika nilai berbeda < 4) */                        \
+void block_lazy_sort_##suffix(type *arr, ptrdiff_t len) {                                            \
+    type t;                                                                                          \
+    for (ptrdiff_t m = 1; m < len; m += 2) {                                                         \
+        if (CMP(arr[m - 1], arr[m]) > 0) { t = arr[m - 1]; arr[m - 1] = arr[m]; arr[m] = t; }        \
+    }                                                                                                \
+    for (ptrdiff_t h = 2; h < len; h *= 2) {                                                         \
+        ptrdiff_t p0 = 0;                                                                            \
+        while (p0 <= len - 2 * h) {                                                                  \
+            block_merge_rotate_##suffix(arr + p0, h, h);                                             \
+            p0 += 2 * h;                                                                             \
+        }                                                                                            \
+        if (len - p0 > h) block_merge_rotate_##suffix(arr + p0, h, len - p0 - h);                    \
+    }                                                                                                \
+}                                                                                                    \
+                                                                                                     \
+/* Menggabungkan setiap pasangan run sepanjang run_len di arr[0..len) per blok lblock */             \
+void block_combine_##suffix(type *keys, type *arr, ptrdiff_t len, ptrdiff_t run_len, ptrdiff_t lblock, int havebuf) { \
+    ptrdiff_t pairs = len / (2 * run_len);                                                           \
+    ptrdiff_t lrest = len % (2 * run_len);                                                           \
+    type t;                                                                                          \
+    if (lrest <= run_len) {                                                                          \
+        len -= lrest; /* Ekor tanpa pasangan sudah terurut */                                        \
+        lrest = 0;                                                                                   \
+    }                                                                                                \
+    for (ptrdiff_t b = 0; b <= pairs; b++) {                                                         \
+        if (b == pairs && lrest == 0) break;                                                         \
+        type *arr1 = arr + b * 2 * run_len;                                                          \
+        ptrdiff_t nblk = (b == pairs ? lrest : 2 * run_len) / lblock;                                \
+        block_insertion_sort_##suffix(keys, nblk + (b == pairs ? 1 : 0));                            \
+        ptrdiff_t midkey = run_len / lblock;                                                         \
+        /* Selection sort blok menurut elemen pertama; key memutus seri */                           \
+        for (ptrdiff_t u = 1; u < nblk; u++) {                                                       \
+            ptrdiff_t p = u - 1;                                                                     \
+            for (ptrdiff_t v = u; v < nblk; v++) {                                                   \
+                int kc = CMP(arr1[p * lblock], arr1[v * lblock]);                                    \
+                if (kc > 0 || (kc == 0 && CMP(keys[p], keys[v]) > 0)) p = v;                         \
+            }                                                                                        \
+            if (p != u - 1) {                                                                        \
+                block_swap_##suffix(arr1 + (u - 1) * lblock, arr1 + p * lblock, lblock);             \
+                t = keys[u - 1]; keys[u - 1] = keys[p]; keys[p] = t;                                 \
+                if (midkey == u - 1 || midkey == p) midkey ^= (u - 1) ^ p;                           \
+            }                                                                                        \
+        }                                                                                            \
+        ptrdiff_t nbl2 = 0, llast = 0;                                                               \
+        if (b == pairs) llast = lrest % lblock;                                                      \
+        if (llast != 0) {                                                                            \
+            while (nbl2 < nblk && CMP(arr1[nblk * lblock], arr1[(nblk - nbl2 - 1) * lblock]) < 0) nbl2++; \
+        }                                                                                            \
+        block_merge_blocks_##suffix(keys, keys[midkey], arr1, nblk - nbl2, lblock, havebuf, nbl2, llast); \
+    }                                                                                                \
+    if (havebuf) {                                                                                   \
+        /* Data tergeser satu blok ke kiri; kembalikan buffer ke depan */                            \
+        while (--len >= 0) {                                                                         \
+            t = arr[len]; arr[len] = arr[len - lblock]; arr[len - lblock] = t;                       \
+        }                                                                                            \
+    }                                                                                                \
+}                                                                                                    \
+                                                                                                     \
+void block_merge_sort_in_place_##suffix(type *arr, ptrdiff_t len) {                                  \
+    if (len < 16) {                                                                                  \
+        block_insertion_sort_##suffix(arr, len);                                                     \
+        return;                                                                                      \
+    }                                                                                                \
+    ptrdiff_t lblock = 1;                                                                            \
+    while (lblock * lblock < len) lblock *= 2;                                                       \
+    ptrdiff_t lkeys = (len - 1) / lblock + 1;                                                        \
+    ptrdiff_t found = block_collect_keys_##suffix(arr, len, lkeys + lblock);                         \
+    int havebuf = 1;                                                                                 \
+    if (found < lkeys + lblock) {                                                                    \
+        if (found < 4) {                                                                             \
+            block_lazy_sort_##suffix(arr, len);                                                      \
+            return;                                                                                  \
+        }                                                                                            \
+        lkeys = lblock;                                                                              \
+        while (lkeys > found) lkeys /= 2;                                                            \
+        havebuf = 0;                                                                                 \
+        lblock = 0;                                                                                  \
+    }                                                                                                \
+    ptrdiff_t ptr = lblock + lkeys;                                                                  \
+    ptrdiff_t cbuf = havebuf ? lblock : lkeys;                                                       \
+    block_build_runs_##suffix(arr + ptr, len - ptr, cbuf);                                           \
+    while (len - ptr > (cbuf *= 2)) {                                                                \
+        ptrdiff_t lb = lblock;                                                                       \
+        int chavebuf = havebuf;                                                                      \
+        if (!havebuf) {                                                                              \
+            if (lkeys > 4 && lkeys / 8 * lkeys >= cbuf) {                                            \
+                lb = lkeys / 2; /* Setengah keys cukup menjadi buffer */                             \
+                chavebuf = 1;                                                                        \
+            } else {                                                                                 \
+                ptrdiff_t nk = 1;                                                                    \
+                unsigned long long s = (unsigned long long)cbuf * (unsigned long long)found / 2;     \
+                while (nk < lkeys && s != 0) {                                                       \
+                    nk *= 2;                                                                         \
+                    s /= 8;                                                                          \
+                }                                                                                    \
+                lb = (2 * cbuf) / nk;                                                                \
+            }                                                                                        \
+        }                                                                                            \
+        block_combine_##suffix(arr, arr + ptr, len - ptr, cbuf, lb, chavebuf);                       \
+    }                                                                                                \
+    block_insertion_sort_##suffix(arr, ptr);                                                         \
+    block_merge_rotate_##suffix(arr, ptr, len - ptr);                                                \
+}
+
+#define BLOCK_CMP_INT(a, b) (((a) > (b)) - ((a) < (b)))
+DEFINE_BLOCK_MERGE_SORT(int, int, BLOCK_CMP_INT)
+DEFINE_BLOCK_MERGE_SORT(str, char *, strcmp)
+
+/**
+ * @brief Block Merge Sort integer dengan scratch buffer dari pemanggil.
+ * @prinsip Jika scratch >= n/2 + 1 elemen, dipakai merge_sort_int_with_scratch
+ *          (merge biasa, tanpa malloc). Jika tidak, array diurutkan di tempat
+ *          dengan block_merge_sort_in_place_int: tetap O(n log n) dan stabil,
+ *          memakai buffer internal yang diambil dari nilai unik array sendiri
+ *          sehingga tidak ada malloc sama sekali.
+ * @param arr Array integer yang akan diurutkan.
+ * @param n Jumlah elemen dalam array.
+ * @param scratch Buffer opsional milik pemanggil (boleh NULL).
+ * @param scratch_len Jumlah elemen int di scratch.
+ */
+void block_merge_sort_int_with_scratch(int arr[], size_t n, int scratch[], size_t scratch_len) {
+    if (n < 2) return;
+    if (scratch && scratch_len >= n / 2 + 1) merge_sort_int_with_scratch(arr, n, scratch, scratch_len);
+    else block_merge_sort_in_place_int(arr, (ptrdiff_t)n);
+}
+
+/**
+ * @brief Mengurutkan array integer dengan Block Merge Sort (stabil, tanpa malloc).
+ * @prinsip Lihat DEFINE_BLOCK_MERGE_SORT. Berbeda dengan merge_sort_int yang
+ *          membutuhkan buffer n/2, versi ini hanya memakai O(1) memori tambahan
+ *          sehingga tidak bisa gagal alokasi, dengan kompleksitas yang sama.
+ * @param arr Array integer yang akan diurutkan.
+ * @param n Jumlah elemen dalam array.
+ */
+void block_merge_sort_int(int arr[], size_t n) {
+    block_merge_sort_int_with_scratch(arr, n, NULL, 0);
+}
+
+// Versi string dari block_merge_sort_int_with_scratch (scratch berisi pointer)
+void block_merge_sort_str_with_scratch(char *arr[], size_t n, char *scratch[], size_t scratch_len) {
+    if (n < 2) return;
+    if (scratch && scratch_len >= n / 2 + 1) merge_sort_str_with_scratch(arr, n, scratch, scratch_len);
+    else block_merge_sort_in_place_str(arr, (ptrdiff_t)n);
+}
+
+/**
+ * @brief Mengurutkan array string dengan Block Merge Sort (stabil, tanpa malloc).
+ * @prinsip Sama seperti block_merge_sort_int, menggunakan strcmp.
+ * @param arr Array pointer ke string (char*) yang akan diurutkan.
+ * @param n Jumlah elemen dalam array.
+ */
+void block_merge_sort_str(char *arr[], size_t n) {
+    block_merge_sort_str_with_scratch(arr, n, NULL, 0);
+}
+
+// === Inline Word Record (string pendek tanpa pointer chasing) ===
+
+// Panjang kata yang seluruhnya muat di key inline (16 byte termasuk NUL).
+#define INLINE_WORD_MAX_LEN 15
+
+/**
+ * Record string dengan key inline 16 byte.
+ * Byte 0..15 string (dipad nol) disimpan sebagai dua integer big-endian,
+ * sehingga urutan (hi, lo) sama dengan urutan strcmp. Kata dengan panjang
+ * <= INLINE_WORD_MAX_LEN dibandingkan sepenuhnya dari key tanpa membaca
+ * memori string. Kata yang lebih panjang memakai str + 16 sebagai tail
+ * out-of-line jika 16 byte pertamanya sama.
+ */
+typedef struct {
+    uint64_t hi;
+    uint64_t lo;
+    char *str; // Pointer string asli (tail dan hasil akhir)
+} InlineWord;
+
+// Mengisi record dari string; membaca paling banyak 16 byte pertama
+void make_inline_word(InlineWord *w, char *s) {
+    unsigned char bytes[16] = {0};
+    size_t i;
+    for (i = 0; i < 16 && s[i] != '\0'; i++)
+        bytes[i] = (unsigned char)s[i];
+    w->hi = 0;
+    w->lo = 0;
+    for (i = 0; i < 8; i++) {
+        w->hi = (w->hi << 8) | bytes[i];
+        w->lo = (w->lo << 8) | bytes[i + 8];
+    }
+    w->str = s;
+}
+
+/**
+ * @brief Membandingkan dua InlineWord (hasil sama seperti strcmp).
+ * @prinsip Dua perbandingan integer 64-bit menggantikan strcmp. Jika kedua
+ *          key sama dan byte ke-16 bukan nol (lo & 0xFF), kedua kata
+ *          lebih panjang dari 15 karakter sehingga sisanya dibandingkan
+ *          dengan strcmp pada tail.
+ */
+int compare_inline_word(const InlineWord *a, const InlineWord *b) {
+    if (a->hi != b->hi) return a->hi < b->hi ? -1 : 1;
+    if (a->lo != b->lo) return a->lo < b->lo ? -1 : 1;
+    if ((a->lo & 0xFF) == 0) return 0; // Kata pendek dan identik
+    return strcmp(a->str + 16, b->str + 16);
+}
+
+// Helper function for merging two sorted InlineWord subarrays
+void merge_inline_word(InlineWord arr[], size_t l, size_t m, size_t r, InlineWord temp[]) {
+    size_t i, j, k;
+    size_t n1 = m - l + 1;
+
+    for (i = 0; i < n1; i++)
+        temp[i] = arr[l + i];
+
+    i = 0;
+    j = m + 1;
+    k = l;
+    while (i < n1 && j <= r) {
+        if (compare_inline_word(&temp[i], &arr[j]) <= 0) {
+            arr[k] = temp[i];
+            i++;
+        } else {
+            arr[k] = arr[j];
+            j++;
+        }
+        k++;
+    }
+    while (i < n1) {
+        arr[k] = temp[i];
+        i++;
+        k++;
+    }
+}
+
+void merge_sort_recursive_inline_word(InlineWord arr[], size_t l, size_t r, InlineWord temp[]) {
+    if (l < r) {
+        size_t m = l + (r - l) / 2;
+        merge_sort_recursive_inline_word(arr, l, m, temp);
+        merge_sort_recursive_inline_word(arr, m + 1, r, temp);
+        merge_inline_word(arr, l, m, r, temp);
+    }
+}
+
+size_t partition_inline_word(InlineWord arr[], size_t low, size_t high) {
+    InlineWord pivot = arr[high];
+    size_t i = low;
+    InlineWord t;
+
+    for (size_t j = low; j < high; j++) {
+        if (compare_inline_word(&arr[j], &pivot) <= 0) {
+            t = arr[i]; arr[i] = arr[j]; arr[j] = t;
+            i++;
+        }
+    }
+    t = arr[i]; arr[i] = arr[high]; arr[high] = t;
+    return i;
+}
+
+void swap_inline_word(InlineWord *a, InlineWord *b) {
+    InlineWord t = *a;
+    *a = *b;
+    *b = t;
+}
+
+// Menurunkan arr[root] ke posisinya di max-heap berukuran n (lihat sift_down_int)
+void sift_down_inline_word(InlineWord arr[], size_t root, size_t n) {
+    InlineWord value = arr[root];
+    size_t child;
+    while ((child = 2 * root + 1) < n) {
+        if (child + 1 < n && compare_inline_word(&arr[child + 1], &arr[child]) > 0) child++;
+        if (compare_inline_word(&arr[child], &value) <= 0) break;
+        arr[root] = arr[child];
+        root = child;
+    }
+    arr[root] = value;
+}
+
+// Heap Sort record inline, fallback introsort (lihat heap_sort_int)
+void heap_sort_inline_word(InlineWord arr[], size_t n) {
+    if (n < 2) return;
+    for (size_t i = n / 2; i-- > 0;)
+        sift_down_inline_word(arr, i, n);
+    for (size_t end = n - 1; end > 0; end--) {
+        swap_inline_word(&arr[0], &arr[end]);
+        sift_down_inline_word(arr, 0, end);
+    }
+}
+
+// Indeks record median dari arr[a], arr[b], arr[c]
+size_t median3_inline_word(const InlineWord arr[], size_t a, size_t b, size_t c) {
+    if (compare_inline_word(&arr[a], &arr[b]) < 0) {
+        if (compare_inline_word(&arr[b], &arr[c]) < 0) return b;
+        return compare_inline_word(&arr[a], &arr[c]) < 0 ? c : a;
+    }
+    if (compare_inline_word(&arr[a], &arr[c]) < 0) return a;
+    return compare_inline_word(&arr[b], &arr[c]) < 0 ? c : b;
+}
+
+// Memindahkan record < pivot ke awal [low, high] (lihat gather_less_int)
+size_t gather_less_inline_word(InlineWord arr[], size_t low, size_t high, InlineWord pivot) {
+    size_t i = low;
+    for (size_t j = low; j <= high; j++) {
+        if (compare_inline_word(&arr[j], &pivot) < 0) {
+            swap_inline_word(&arr[i], &arr[j]);
+            i++;
+        }
+    }
+    return i;
+}
+
+/**
+ * @brief Rekursi Quick Sort record inline (introsort).
+ * @prinsip Pivot median-of-three, atau ninther (median dari tiga median)
+ *          untuk rentang > 128 record, dipindah ke posisi high. Pivot dari
+ *          elemen terakhir saja membuat input terurut sebagian atau
+ *          naik-lalu-turun (organ-pipe) menjadi O(n^2). Kunci yang sama
+ *          dengan batas atas dan batas kedalaman ditangani seperti
+ *          quick_sort_recursive_int_dispatch, dengan heap_sort_inline_word
+ *          sebagai fallback. Rekursi hanya pada sisi yang lebih kecil.
+ * @param has_bound 1 jika arr[high + 1] ada dan >= semua record di [low, high].
+ * @param depth Sisa kedalaman partisi sebelum beralih ke heap sort.
+ */
+void quick_sort_recursive_inline_word(InlineWord arr[], size_t low, size_t high, int has_bound, int depth) {
+    while (low < high) {
+        if (depth-- == 0) {
+            heap_sort_inline_word(arr + low, high - low + 1);
+            return;
+        }
+
+        size_t mid = low + (high - low) / 2;
+        size_t p;
+        if (high - low + 1 > 128) {
+            size_t s = (high - low + 1) / 8;
+            p = median3_inline_word(arr, median3_inline_word(arr, low, low + s, low + 2 * s),
+                                    median3_inline_word(arr, mid - s, mid, mid + s),
+                                    median3_inline_word(arr, high - 2 * s, high - s, high));
+        } else {
+            p = median3_inline_word(arr, low, mid, high);
+        }
+        swap_inline_word(&arr[p], &arr[high]);
+
+        if (has_bound && compare_inline_word(&arr[high], &arr[high + 1]) == 0) {
+            size_t eq = gather_less_inline_word(arr, low, high, arr[high]);
+            if (eq == low) return;
+            high = eq - 1;
+            continue;
+        }
+
+        size_t pi = partition_inline_word(arr, low, high);
+        if (pi - low < high - pi) {
+            if (pi > low) quick_sort_recursive_inline_word(arr, low, pi - 1, 1, depth);
+            low = pi + 1;
+        } else {
+            quick_sort_recursive_inline_word(arr, pi + 1, high, has_bound, depth);
+            if (pi == low) return;
+            high = pi - 1;
+            has_bound = 1;
+        }
+    }
+}
+
+// Mengemas arr ke record inline; mengembalikan NULL jika alokasi gagal
+InlineWord *pack_inline_words(char *arr[], size_t n) {
+    InlineWord *words = (InlineWord *)malloc((n ? n : 1) * sizeof(InlineWord));
+    if (!words) {
+        perror("Gagal alokasi memori untuk record kata inline");
+        return NULL;
+    }
+    for (size_t i = 0; i < n; i++)
+        make_inline_word(&words[i], arr[i]);
+    return words;
+}
+
+/**
+ * @brief Merge Sort string melalui record inline 16 byte.
+ * @prinsip Pointer dikemas menjadi InlineWord (satu pass berurutan), record
+ *          yang bersebelahan di memori diurutkan dengan Merge Sort tanpa
+ *          dereferensi pointer, lalu pointer hasil urutan ditulis kembali ke
+ *          arr. Hasil identik dengan merge_sort_str (stabil).
+ * @param arr Array pointer ke string (char*) yang akan diurutkan.
+ * @param n Jumlah elemen dalam array.
+ */
+void merge_sort_str_inline(char *arr[], size_t n) {
+    if (n < 2) return;
+    InlineWord *words = pack_inline_words(arr, n);
+    if (!words) return;
+    InlineWord *temp = (InlineWord *)malloc((n / 2 + 1) * sizeof(InlineWord));
+    if (!temp) {
+        perror("Gagal alokasi memori untuk merge sort temp inline");
+        free(words);
+        return;
+    }
+    merge_sort_recursive_inline_word(words, 0, n - 1, temp);
+    for (size_t i = 0; i < n; i++)
+        arr[i] = words[i].str;
+    free(temp);
+    free(words);
+}
+
+/**
+ * @brief Quick Sort string melalui record inline 16 byte.
+ * @prinsip Sama seperti merge_sort_str_inline, tetapi partisi dilakukan
+ *          pada record inline (tanpa memori tambahan selain array record)
+ *          dengan introsort sehingga O(n log n) untuk input apapun. Tidak stabil.
+ * @param arr Array pointer ke string (char*) yang akan diurutkan.
+ * @param n Jumlah elemen dalam array.
+ */
+void quick_sort_str_inline(char *arr[], size_t n) {
+    if (n < 2) return;
+    InlineWord *words = pack_inline_words(arr, n);
+    if (!words) return;
+    quick_sort_recursive_inline_word(words, 0, n - 1, 0, introsort_depth_limit(n));
+    for (size_t i = 0; i < n; i++)
+        arr[i] = words[i].str;
+    free(words);
+}
+
+// === Sorting Inkremental (batch baru digabung ke array terurut) ===
+
+// Jumlah kemenangan beruntun satu sisi sebelum merge beralih ke mode galloping.
+#define GALLOP_MIN 7
+
+// Array yang selalu terurut; batch baru ditambahkan dengan sorted_array_append_*
+typedef struct {
+    int *data;       // data[0..count) selalu terurut
+    size_t count;
+    size_t capacity;
+} SortedIntArray;
+
+// Versi string; hanya pointer yang disimpan (string tetap milik pemanggil)
+typedef struct {
+    char **data;
+    size_t count;
+    size_t capacity;
+} SortedStrArray;
+
+/**
+ * @brief Mencari, dari ujung kanan, posisi pertama p di arr[first..last)
+ *        dengan arr[p..last) > key (sama seperti upper_bound_int).
+ * @prinsip Exponential search: cek arr[last-1], arr[last-2], arr[last-4], ...
+ *          hingga menemukan elemen <= key, lalu binary search pada rentang
+ *          terakhir. Biaya O(log d) dengan d jarak hasil dari ujung kanan,
+ *          sehingga murah untuk run panjang saat merge dalam mode galloping.
+ */
+size_t gallop_upper_int(const int arr[], size_t first, size_t last, int key) {
+    size_t len = last - first, prev = 0, ofs = 1;
+    while (ofs <= len && arr[last - ofs] > key) { prev = ofs; ofs *= 2; }
+    size_t lo = ofs <= len ? last - ofs + 1 : first;
+    return upper_bound_int(arr, lo, last - prev, key);
+}
+
+// Seperti gallop_upper_int, tetapi posisi pertama dengan arr[p..last) >= key
+size_t gallop_lower_int(const int arr[], size_t first, size_t last, int key) {
+    size_t len = last - first, prev = 0, ofs = 1;
+    while (ofs <= len && arr[last - ofs] >= key) { prev = ofs; ofs *= 2; }
+    size_t lo = ofs <= len ? last - ofs + 1 : first;
+    return lower_bound_int(arr, lo, last - prev, key);
+}
+
+size_t gallop_upper_str(char *const arr[], size_t first, size_t last, const char *key) {
+    size_t len = last - first, prev = 0, ofs = 1;
+    while (ofs <= len && strcmp(arr[last - ofs], key) > 0) { prev = ofs; ofs *= 2; }
+    size_t lo = ofs <= len ? last - ofs + 1 : first;
+    return upper_bound_str(arr, lo, last - prev, key);
+}
+
+size_t gallop_lower_str(char *const arr[], size_t first, size_t last, const char *key) {
+    size_t len = last - first, prev = 0, ofs = 1;
+    while (ofs <= len && strcmp(arr[last - ofs], key) >= 0) { prev = ofs; ofs *= 2; }
+    size_t lo = ofs <= len ? last - ofs + 1 : first;
+    return lower_bound_str(arr, lo, last - prev, key);
+}
+
+/**
+ * @brief Menggabungkan arr[first..middle) dan arr[middle..last) secara stabil
+ *        dari belakang, dengan galloping.
+ * @prinsip Sisi kanan disalin ke buf (butuh last - middle elemen), lalu kedua
+ *          sisi di-merge mundur ke arr. Jika satu sisi menang GALLOP_MIN kali
+ *          berturut-turut, seluruh run sisi tersebut dicari dengan
+ *          gallop_*_int dan dipindahkan sekaligus dengan memmove/memcpy.
+ *          Untuk batch kecil yang disisipkan ke array besar, sebagian besar
+ *          elemen lama berpindah per blok, bukan per perbandingan.
+ */
+void gallop_merge_int(int arr[], size_t first, size_t middle, size_t last, int buf[]) {
+    size_t i = middle, j = last - middle, dest = last;
+    int wins_left = 0, wins_right = 0;
+    memcpy(buf, &arr[middle], j * sizeof(int));
+    while (i > first && j > 0) {
+        if (arr[i - 1] > buf[j - 1]) { // Sama besar: sisi kanan ditaruh belakang (stabil)
+            arr[--dest] = arr[--i];
+            wins_right = 0;
+            if (++wins_left >= GALLOP_MIN) {
+                size_t run = i - gallop_upper_int(arr, first, i, buf[j - 1]);
+                dest -= run; i -= run;
+                memmove(&arr[dest], &arr[i], run * sizeof(int));
+                wins_left = 0;
+            }
+        } else {
+            arr[--dest] = buf[--j];
+            wins_left = 0;
+            if (++wins_right >= GALLOP_MIN && j > 0) {
+                size_t run = j - gallop_lower_int(buf, 0, j, arr[i - 1]);
+                dest -= run; j -= run;
+                memcpy(&arr[dest], &buf[j], run * sizeof(int));
+                wins_right = 0;
+            }
+        }
+    }
+    memcpy(&arr[first], buf, j * sizeof(int)); // Sisa sisi kanan (sisa kiri sudah di tempat)
+}
+
+void gallop_merge_str(char *arr[], size_t first, size_t middle, size_t last, char *buf[]) {
+    size_t i = middle, j = last - middle, dest = last;
+    int wins_left = 0, wins_right = 0;
+    memcpy(buf, &arr[middle], j * sizeof(char *));
+    while (i > first && j > 0) {
+        if (strcmp(arr[i - 1], buf[j - 1]) > 0) {
+            arr[--dest] = arr[--i];
+            wins_right = 0;
+            if (++wins_left >= GALLOP_MIN) {
+                size_t run = i - gallop_upper_str(arr, first, i, buf[j - 1]);
+                dest -= run; i -= run;
+                memmove(&arr[dest], &arr[i], run * sizeof(char *));
+                wins_left = 0;
+            }
+        } else {
+            arr[--dest] = buf[--j];
+            wins_left = 0;
+            if (++wins_right >= GALLOP_MIN && j > 0) {
+                size_t run = j - gallop_lower_str(buf, 0, j, arr[i - 1]);
+                dest -= run; j -= run;
+                memcpy(&arr[dest], &buf[j], run * sizeof(char *));
+                wins_right = 0;
+            }
+        }
+    }
+    memcpy(&arr[first], buf, j * sizeof(char *));
+}
+
+void sorted_array_init_int(SortedIntArray *s) { s->data = NULL; s->count = 0; s->capacity = 0; }
+void sorted_array_init_str(SortedStrArray *s) { s->data = NULL; s->count = 0; s->capacity = 0; }
+void sorted_array_free_int(SortedIntArray *s) { free(s->data); sorted_array_init_int(s); }
+void sorted_array_free_str(SortedStrArray *s) { free(s->data); sorted_array_init_str(s); } // String tidak dibebaskan
+
+// Memastikan kapasitas >= needed (tumbuh berlipat dua); NULL jika gagal (data lama tetap valid)
+void *sorted_array_grow(void *data, size_t *capacity, size_t needed, size_t elem_size) {
+    if (needed <= *capacity) return data;
+    size_t cap = *capacity ? *capacity : 1024;
+    while (cap < needed) cap = cap > SIZE_MAX / 2 ? needed : cap * 2;
+    if (cap > SIZE_MAX / elem_size) return NULL;
+    void *grown = realloc(data, cap * elem_size);
+    if (grown) *capacity = cap;
+    return grown;
+}
+
+/**
+ * @brief Menambahkan batch belum terurut ke SortedIntArray tanpa mengurutkan ulang semuanya.
+ * @prinsip Batch disalin ke ekor array dan hanya batch yang diurutkan
+ *          (O(k log k)). Kemudian bagian yang sudah di posisi akhir dipangkas
+ *          dengan binary search: elemen lama <= batch terkecil dan elemen batch
+ *          >= elemen lama terbesar tidak perlu dipindah. Sisanya digabung:
+ *          - scratch >= sisa batch: gallop_merge_int (O(n) tetapi run panjang
+ *            dipindah per blok);
+ *          - scratch kurang: block_merge_int di tempat (SymMerge + rotasi),
+ *            dengan buffer stack jika scratch NULL.
+ *          Total O(k log k + n) alih-alih O((n + k) log (n + k)). Stabil: untuk
+ *          nilai sama, elemen lama tetap di depan elemen batch.
+ * @param s Array terurut (data tumbuh otomatis dengan realloc).
+ * @param batch Elemen baru (tidak diubah, boleh belum terurut).
+ * @param k Jumlah elemen batch.
+ * @param scratch Buffer kerja dari pemanggil (boleh NULL); idealnya >= k elemen.
+ * @param scratch_len Kapasitas scratch dalam elemen.
+ * @return 1 jika berhasil, 0 jika alokasi gagal (isi s tidak berubah).
+ */
+int sorted_array_append_int(SortedIntArray *s, const int batch[], size_t k, int scratch[], size_t scratch_len) {
+    if (k == 0) return 1;
+    int *arr = k <= SIZE_MAX - s->count ? (int *)sorted_array_grow(s->data, &s->capacity, s->count + k, sizeof(int)) : NULL;
+    if (!arr) {
+        perror("Gagal alokasi memori untuk sorted array");
+        return 0;
+    }
+    s->data = arr;
+    size_t middle = s->count, last = s->count + k;
+    memcpy(&arr[middle], batch, k * sizeof(int));
+    block_merge_sort_int_with_scratch(&arr[middle], k, scratch, scratch_len);
+    s->count = last;
+    if (middle == 0 || arr[middle - 1] <= arr[middle]) return 1; // Batch seluruhnya di belakang
+
+    size_t first = upper_bound_int(arr, 0, middle, arr[middle]);
+    last = lower_bound_int(arr, middle, last, arr[middle - 1]);
+    if (scratch && scratch_len >= last - middle) {
+        gallop_merge_int(arr, first, middle, last, scratch);
+    } else {
+        int internal[BLOCK_MERGE_INTERNAL_BUFFER];
+        int *buf = scratch && scratch_len > BLOCK_MERGE_INTERNAL_BUFFER ? scratch : internal;
+        size_t buf_len = buf == scratch ? scratch_len : BLOCK_MERGE_INTERNAL_BUFFER;
+        block_merge_int(arr, first, middle, last, buf, buf_len);
+    }
+    return 1;
+}
+
+// Versi string dari sorted_array_append_int (pointer batch disalin, string tidak)
+int sorted_array_append_str(SortedStrArray *s, char *const batch[], size_t k, char *scratch[], size_t scratch_len) {
+    if (k == 0) return 1;
+    char **arr = k <= SIZE_MAX - s->count ? (char **)sorted_array_grow(s->data, &s->capacity, s->count + k, sizeof(char *)) : NULL;
+    if (!arr) {
+        perror("Gagal alokasi memori untuk sorted array string");
+        return 0;
+    }
+    s->data = arr;
+    size_t middle = s->count, last = s->count + k;
+    memcpy(&arr[middle], batch, k * sizeof(char *));
+    block_merge_sort_str_with_scratch(&arr[middle], k, scratch, scratch_len);
+    s->count = last;
+    if (middle == 0 || strcmp(arr[middle - 1], arr[middle]) <= 0) return 1;
+
+    size_t first = upper_bound_str(arr, 0, middle, arr[middle]);
+    last = lower_bound_str(arr, middle, last, arr[middle - 1]);
+    if (scratch && scratch_len >= last - middle) {
+        gallop_merge_str(arr, first, middle, last, scratch);
+    } else {
+        char *internal[BLOCK_MERGE_INTERNAL_BUFFER];
+        char **buf = scratch && scratch_len > BLOCK_MERGE_INTERNAL_BUFFER ? scratch : internal;
+        size_t buf_len = buf == scratch ? scratch_len : BLOCK_MERGE_INTERNAL_BUFFER;
+        block_merge_str(arr, first, middle, last, buf, buf_len);
+    }
+    return 1;
+}
+
+// === Kata Unik + Frekuensi (Sort + Unique + Count) ===
+
+// Pasangan (kata, jumlah kemunculan)
+typedef struct {
+    char *word;
+    size_t count;
+} WordCount;
+
+/**
+ * @brief Merge Sort rekursif yang sekaligus menggabungkan kata yang sama.
+ * @prinsip Invarian: setelah dipanggil, a[0..k) terurut dan setiap kata
+ *          hanya muncul sekali (count berisi total kemunculan). Saat dua run
+ *          unik di-merge, hasil strcmp yang sudah dihitung untuk merge
+ *          sekaligus mendeteksi duplikat (hasil 0 -> count dijumlahkan, satu
+ *          elemen ditulis). Tidak ada strcmp tambahan, dan run menyusut di
+ *          setiap level sehingga data dengan banyak duplikat makin cepat.
+ * @param a Array WordCount yang akan diurutkan dan digabung di tempat.
+ * @param n Jumlah elemen.
+ * @param temp Buffer sementara berukuran minimal n/2.
+ * @return Jumlah kata unik k.
+ */
+size_t merge_count_recursive(WordCount a[], size_t n, WordCount temp[]) {
+    if (n < 2) return n;
+    size_t half = n / 2;
+    size_t k1 = merge_count_recursive(a, half, temp);
+    size_t k2 = merge_count_recursive(a + half, n - half, temp);
+
+    // Salin run kiri ke temp, merge dengan run kanan (a[half..half+k2)) ke a[0..)
+    memcpy(temp, a, k1 * sizeof(WordCount));
+    size_t i = 0, j = half, k = 0;
+    size_t right_end = half + k2;
+    while (i < k1 && j < right_end) {
+        int c = strcmp(temp[i].word, a[j].word);
+        if (c < 0) {
+            a[k++] = temp[i++];
+        } else if (c > 0) {
+            a[k++] = a[j++];
+        } else {
+            // Kata sama: simpan sekali dengan jumlah digabung
+            a[k] = temp[i++];
+            a[k++].count += a[j++].count;
+        }
+    }
+    while (i < k1) a[k++] = temp[i++];
+    while (j < right_end) a[k++] = a[j++];
+    return k;
+}
+
+/**
+ * @brief Mengurutkan kata dan menghasilkan pasangan (kata unik, jumlah) dalam
+ *        satu operasi (fused sort + unique + count).
+ * @param arr Array pointer ke string (tidak diubah).
+ * @param n Jumlah kata.
+ * @param out Array output berukuran minimal n; out[0..k) berisi hasil terurut.
+ * @return Jumlah kata unik k (0 jika alokasi gagal dan n > 0).
+ */
+size_t sort_unique_count_str(char *const arr[], size_t n, WordCount out[]) {
+    for (size_t i = 0; i < n; i++) {
+        out[i].word = arr[i];
+        out[i].count = 1;
+    }
+    if (n < 2) return n;
+    WordCount *temp = (WordCount *)malloc((n / 2 + 1) * sizeof(WordCount));
+    if (!temp) {
+        perror("Gagal alokasi memori untuk sort unique count temp");
+        return 0;
+    }
+    size_t k = merge_count_recursive(out, n, temp);
+    free(temp);
+    return k;
+}
+
+/**
+ * @brief Pembanding: menghitung run kata sama pada array yang sudah terurut
+ *        (langkah "scan" dari sort-then-scan).
+ * @param sorted Array pointer ke string yang sudah terurut.
+ * @param n Jumlah kata.
+ * @param out Array output berukuran minimal n.
+ * @return Jumlah kata unik.
+ */
+size_t count_sorted_runs_str(char *const sorted[], size_t n, WordCount out[]) {
+    size_t k = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (k > 0 && strcmp(out[k - 1].word, sorted[i]) == 0) {
+            out[k - 1].count++;
+        } else {
+            out[k].word = sorted[i];
+            out[k].count = 1;
+            k++;
+        }
+    }
+    return k;
+}
+
+// Slot tabel hash untuk hash_count_str (word == NULL berarti kosong)
+typedef struct {
+    char *word;
+    size_t count;
+    uint64_t hash;
+} WordCountSlot;
+
+// Hash FNV-1a 64-bit
+uint64_t hash_string_fnv1a(const char *s) {
+    uint64_t h = 14695981039346656037ULL;
+    while (*s) {
+        h ^= (unsigned char)*s++;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// Memperbesar tabel menjadi new_capacity (pangkat dua) dan memindahkan semua entri
+int hash_count_grow(WordCountSlot **table, size_t *capacity, size_t new_capacity) {
+    WordCountSlot *bigger = (WordCountSlot *)calloc(new_capacity, sizeof(WordCountSlot));
+    if (!bigger) {
+        perror("Gagal alokasi memori untuk tabel hash kata");
+        return 0;
+    }
+    for (size_t i = 0; i < *capacity; i++) {
+        if ((*table)[i].word) {
+            size_t pos = (size_t)(*table)[i].hash & (new_capacity - 1);
+            while (bigger[pos].word) pos = (pos + 1) & (new_capacity - 1);
+            bigger[pos] = (*table)[i];
+        }
+    }
+    free(*table);
+    *table = bigger;
+    *capacity = new_capacity;
+    return 1;
+}
+
+/**
+ * @brief Alternatif hash-aggregation untuk input dengan sedikit kata unik.
+ * @prinsip Setiap kata di-hash (FNV-1a) ke tabel open addressing (linear
+ *          probing, load factor <= 0.5). strcmp hanya dilakukan jika hash
+ *          64-bit sama. Setelah semua kata dihitung, hanya k kata unik yang
+ *          diurutkan (O(n + k log k) alih-alih O(n log n)).
+ * @param arr Array pointer ke string (tidak diubah).
+ * @param n Jumlah kata.
+ * @param out Array output berukuran minimal n; out[0..k) terurut menurut kata.
+ * @return Jumlah kata unik k (0 jika alokasi gagal dan n > 0).
+ */
+size_t hash_count_str(char *const arr[], size_t n, WordCount out[]) {
+    size_t capacity = 1024;
+    size_t used = 0;
+    WordCountSlot *table = (WordCountSlot *)calloc(capacity, sizeof(WordCountSlot));
+    if (!table) {
+        perror("Gagal alokasi memori untuk tabel hash kata");
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++) {
+        uint64_t h = hash_string_fnv1a(arr[i]);
+        size_t pos = (size_t)h & (capacity - 1);
+        while (table[pos].word && !(table[pos].hash == h && strcmp(table[pos].word, arr[i]) == 0))
+            pos = (pos + 1) & (capacity - 1);
+        if (table[pos].word) {
+            table[pos].count++;
+            continue;
+        }
+        table[pos].word = arr[i];
+        table[pos].count = 1;
+        table[pos].hash = h;
+        used++;
+        if (used * 2 > capacity && !hash_count_grow(&table, &capacity, capacity * 2)) {
+            free(table);
+            return 0;
+        }
+    }
+
+    size_t k = 0;
+    for (size_t i = 0; i < capacity; i++) {
+        if (table[i].word) {
+            out[k].word = table[i].word;
+            out[k].count = table[i].count;
+            k++;
+        }
+    }
+    free(table);
+
+    // Semua kata sudah unik, merge_count_recursive di sini hanya mengurutkan
+    if (k > 1) {
+        WordCount *temp = (WordCount *)malloc((k / 2 + 1) * sizeof(WordCount));
+        if (!temp) {
+            perror("Gagal alokasi memori untuk sort hasil hash count");
+            return 0;
+        }
+        merge_count_recursive(out, k, temp);
+        free(temp);
     }
+    return k;
+}
+
+// === Argsort & Key-Payload Sort ===
+
+// Pasangan (key int, payload indeks 64-bit) untuk array dengan > 2^32 elemen.
+typedef struct {
+    int key;
+    uint64_t index;
+} IntKeyIndex64;
+
+// Pasangan (key string, payload indeks) untuk argsort string.
+typedef struct {
+    const char *key;
+    size_t index;
+} StrKeyIndex;
+
+// Pilihan algoritma dasar untuk argsort / key-payload sort.
+typedef enum {
+    ARGSORT_MERGE,
+    ARGSORT_QUICK,
+    ARGSORT_SHELL
+} ArgsortMethod;
+
+/**
+ * @brief Mengemas key int dan payload indeks 32-bit menjadi satu uint64_t.
+ * @prinsip Bit tanda key dibalik (key ^ 0x80000000) agar urutan unsigned
+ *          sama dengan urutan signed, lalu diletakkan di 32 bit atas. Indeks
+ *          di 32 bit bawah sekaligus menjadi tie-breaker, sehingga hasil sort
+ *          selalu stabil walaupun memakai Quick Sort atau Shell Sort.
+ */
+uint64_t pack_key_index_int(int key, uint32_t index) {
+    return ((uint64_t)((uint32_t)key ^ 0x80000000u) << 32) | index;
+}
+
+// Mengambil kembali key int dari pasangan terkemas
+int unpack_key_int(uint64_t packed) {
+    return (int)((uint32_t)(packed >> 32) ^ 0x80000000u);
+}
+
+// Mengambil kembali payload indeks dari pasangan terkemas
+uint32_t unpack_index(uint64_t packed) {
+    return (uint32_t)packed;
+}
+
+/**
+ * @brief Membangkitkan merge sort, quick sort, dan shell sort untuk satu tipe
+ *        elemen, beserta dispatcher per ArgsortMethod.
+ * @prinsip Pasangan key-payload (uint64_t terkemas, IntKeyIndex64, StrKeyIndex)
+ *          hanya berbeda di tipe elemen dan perbandingannya, jadi badan
+ *          algoritma ditulis sekali di sini. LESS_EQ(a, b) bernilai benar jika
+ *          elemen a boleh berada sebelum b. Merge sort selalu stabil; quick
+ *          sort dan shell sort hanya stabil jika LESS_EQ memakai indeks sebagai
+ *          tie-breaker (seperti ketiga pasangan key-payload). Quick sort memakai
+ *          pivot median-of-three, karena key sama + indeks naik menjadi deret
+ *          terurut, dan hanya merekursi sisi yang lebih kecil agar kedalaman
+ *          stack O(log n).
+ *          Fungsi yang dibangkitkan: merge_##suffix, merge_sort_recursive_##suffix,
+ *          merge_sort_##suffix (return 0 jika alokasi temp gagal),
+ *          partition_##suffix, quick_sort_recursive_##suffix, quick_sort_##suffix,
+ *          shell_sort_##suffix, dan sort_by_method_##suffix.
+ * @param suffix Akhiran nama fungsi yang dibangkitkan.
+ * @param type Tipe elemen.
+ * @param LESS_EQ Makro atau fungsi perbandingan dua nilai bertipe `type`.
+ */
+#define DEFINE_ELEMENT_SORTS(suffix, type, LESS_EQ)                                       \
+void merge_##suffix(type arr[], size_t l, size_t m, size_t r, type temp[]) {              \
+    size_t i, j, k;                                                                       \
+    size_t n1 = m - l + 1;                                                                \
+    for (i = 0; i < n1; i++)                                                              \
+        temp[i] = arr[l + i];                                                             \
+    i = 0;                                                                                \
+    j = m + 1;                                                                            \
+    k = l;                                                                                \
+    while (i < n1 && j <= r) {                                                            \
+        if (LESS_EQ(temp[i], arr[j])) { arr[k++] = temp[i++]; }                           \
+        else { arr[k++] = arr[j++]; }                                                     \
+    }                                                                                     \
+    while (i < n1) { arr[k++] = temp[i++]; }                                              \
+}                                                                                         \
+                                                                                          \
+void merge_sort_recursive_##suffix(type arr[], size_t l, size_t r, type temp[]) {         \
+    if (l < r) {                                                                          \
+        size_t m = l + (r - l) / 2;                                                       \
+        merge_sort_recursive_##suffix(arr, l, m, temp);                                   \
+        merge_sort_recursive_##suffix(arr, m + 1, r, temp);                               \
+        merge_##suffix(arr, l, m, r, temp);                                               \
+    }                                                                                     \
+}                                                                                         \
+                                                                                          \
+int merge_sort_##suffix(type arr[], size_t n) {                                           \
+    if (n < 2) return 1;                                                                  \
+    type *temp = (type *)malloc((n / 2 + 1) * sizeof(type));                              \
+    if (!temp) {                                                                          \
+        perror("Gagal alokasi memori untuk merge sort temp " #suffix);                    \
+        return 0;                                                                         \
+    }                                                                                     \
+    merge_sort_recursive_##suffix(arr, 0, n - 1, temp);                                   \
+    free(temp);                                                                           \
+    return 1;                                                                             \
+}                                                                                         \
+                                                                                          \
+size_t partition_##suffix(type arr[], size_t low, size_t high) {                          \
+    type pivot = arr[high];                                                               \
+    size_t i = low;                                                                       \
+    type t;                                                                               \
+    for (size_t j = low; j < high; j++) {                                                 \
+        if (LESS_EQ(arr[j], pivot)) {                                                     \
+            t = arr[i]; arr[i] = arr[j]; arr[j] = t;                                      \
+            i++;                                                                          \
+        }                                                                                 \
+    }                                                                                     \
+    t = arr[i]; arr[i] = arr[high]; arr[high] = t;                                        \
+    return i;                                                                             \
+}                                                                                         \
+                                                                                          \
+void quick_sort_recursive_##suffix(type arr[], size_t low, size_t high) {                 \
+    type t;                                                                               \
+    while (low < high) {                                                                  \
+        size_t mid = low + (high - low) / 2;                                              \
+        if (!LESS_EQ(arr[low], arr[mid])) { t = arr[mid]; arr[mid] = arr[low]; arr[low] = t; }     \
+        if (!LESS_EQ(arr[low], arr[high])) { t = arr[high]; arr[high] = arr[low]; arr[low] = t; }  \
+        if (!LESS_EQ(arr[high], arr[mid])) { t = arr[mid]; arr[mid] = arr[high]; arr[high] = t; }  \
+                                                                                          \
+        size_t pi = partition_##suffix(arr, low, high);                                   \
+        if (pi - low < high - pi) {                                                       \
+            if (pi > low) quick_sort_recursive_##suffix(arr, low, pi - 1);                \
+            low = pi + 1;                                                                 \
+        } else {                                                                          \
+            quick_sort_recursive_##suffix(arr, pi + 1, high);                             \
+            if (pi == low) return;                                                        \
+            high = pi - 1;                                                                \
+        }                                                                                 \
+    }                                                                                     \
+}                                                                                         \
+                                                                                          \
+void quick_sort_##suffix(type arr[], size_t n) {                                          \
+    if (n < 2) return;                                                                    \
+    quick_sort_recursive_##suffix(arr, 0, n - 1);                                         \
+}                                                                                         \
+                                                                                          \
+void shell_sort_##suffix(type arr[], size_t n) {                                          \
+    size_t h = 1;                                                                         \
+    while (h < n / 3) {                                                                   \
+        h = 3 * h + 1;                                                                    \
+    }                                                                                     \
+    while (h >= 1) {                                                                      \
+        for (size_t i = h; i < n; i++) {                                                  \
+            type temp = arr[i];                                                           \
+            size_t j;                                                                     \
+            for (j = i; j >= h && !LESS_EQ(arr[j - h], temp); j -= h) {                   \
+                arr[j] = arr[j - h];                                                      \
+            }                                                                             \
+            arr[j] = temp;                                                                \
+        }                                                                                 \
+        h = h / 3;                                                                        \
+    }                                                                                     \
+}                                                                                         \
+                                                                                          \
+int sort_by_method_##suffix(type arr[], size_t n, ArgsortMethod method) {                 \
+    switch (method) {                                                                     \
+        case ARGSORT_QUICK: quick_sort_##suffix(arr, n); return 1;                        \
+        case ARGSORT_SHELL: shell_sort_##suffix(arr, n); return 1;                        \
+        case ARGSORT_MERGE:                                                               \
+        default:            return merge_sort_##suffix(arr, n);                           \
+    }                                                                                     \
+}
+
+// Pasangan terkemas unik (indeks di 32 bit bawah), cukup dibandingkan sebagai uint64_t
+#define PACKED_KEY_INDEX_LESS_EQ(a, b) ((a) <= (b))
+
+// Key int lalu indeks sebagai tie-breaker
+#define KEY_INDEX64_INT_LESS_EQ(a, b) ((a).key < (b).key || ((a).key == (b).key && (a).index <= (b).index))
+
+// Membandingkan dua StrKeyIndex: strcmp pada key, lalu indeks sebagai tie-breaker
+int compare_str_key_index(const StrKeyIndex *a, const StrKeyIndex *b) {
+    int c = strcmp(a->key, b->key);
+    if (c != 0) return c;
+    return (a->index > b->index) - (a->index < b->index);
+}
+
+#define STR_KEY_INDEX_LESS_EQ(a, b) (compare_str_key_index(&(a), &(b)) <= 0)
+
+DEFINE_ELEMENT_SORTS(u64, uint64_t, PACKED_KEY_INDEX_LESS_EQ)
+DEFINE_ELEMENT_SORTS(key_index64_int, IntKeyIndex64, KEY_INDEX64_INT_LESS_EQ)
+DEFINE_ELEMENT_SORTS(str_key_index, StrKeyIndex, STR_KEY_INDEX_LESS_EQ)
+
+/**
+ * @brief Mengurutkan pasangan (key int, indeks 32-bit) yang sudah dikemas.
+ * @prinsip Karena key dan indeks berada dalam satu uint64_t, perbandingan
+ *          cukup satu instruksi dan setiap pertukaran hanya memindahkan 8 byte,
+ *          berapapun ukuran record aslinya.
+ * @param packed Array hasil pack_key_index_int.
+ * @param n Jumlah pasangan.
+ * @param method Algoritma dasar yang dipakai.
+ * @return 1 jika berhasil, 0 jika alokasi memori gagal (array tidak terurut).
+ */
+int sort_key_index32_int(uint64_t packed[], size_t n, ArgsortMethod method) {
+    return sort_by_method_u64(packed, n, method);
+}
+
+/**
+ * @brief Mengurutkan pasangan (key int, indeks 64-bit) dengan algoritma pilihan.
+ * @prinsip Dipakai jika jumlah elemen melebihi 2^32 sehingga indeks tidak
+ *          muat di pasangan terkemas 64-bit. Indeks menjadi tie-breaker,
+ *          sehingga hasilnya stabil untuk ketiga metode.
+ * @param pairs Array pasangan key-indeks.
+ * @param n Jumlah pasangan.
+ * @param method Algoritma dasar yang dipakai.
+ * @return 1 jika berhasil, 0 jika alokasi memori gagal (array tidak terurut).
+ */
+int sort_key_index64_int(IntKeyIndex64 pairs[], size_t n, ArgsortMethod method) {
+    return sort_by_method_key_index64_int(pairs, n, method);
+}
+
+/**
+ * @brief Mengurutkan pasangan (key string, indeks) dengan algoritma pilihan.
+ * @prinsip Indeks menjadi tie-breaker, sehingga ketiga metode menghasilkan
+ *          permutasi yang sama (stabil). Hanya pasangan 16 byte yang dipindah.
+ * @param pairs Array pasangan key-indeks.
+ * @param n Jumlah pasangan.
+ * @param method Algoritma dasar yang dipakai.
+ * @return 1 jika berhasil, 0 jika alokasi memori gagal (array tidak terurut).
+ */
+int sort_key_index_str(StrKeyIndex pairs[], size_t n, ArgsortMethod method) {
+    return sort_by_method_str_key_index(pairs, n, method);
+}
+
+/**
+ * @brief Menghitung permutasi indeks yang mengurutkan array integer (argsort).
+ * @prinsip Array asli tidak diubah. Untuk n <= 2^32 key dan indeks dikemas
+ *          ke uint64_t lalu diurutkan; selain itu memakai pasangan IntKeyIndex64.
+ *          Hasilnya stabil: arr[idx[0]] <= arr[idx[1]] <= ..., dan indeks
+ *          dengan key sama tetap berurutan naik.
+ * @param arr Array integer sumber (tidak diubah).
+ * @param idx Array output berukuran n untuk permutasi indeks.
+ * @param n Jumlah elemen.
+ * @param method Algoritma dasar yang dipakai.
+ * @return 1 jika berhasil, 0 jika alokasi memori gagal.
+ */
+int argsort_int(const int arr[], size_t idx[], size_t n, ArgsortMethod method) {
+    // Dibandingkan dalam uint64_t: (size_t)UINT32_MAX + 1 bernilai 0 jika size_t 32-bit
+    if ((uint64_t)n <= (uint64_t)UINT32_MAX + 1) {
+        uint64_t *packed = (uint64_t *)malloc((n ? n : 1) * sizeof(uint64_t));
+        if (!packed) {
+            perror("Gagal alokasi memori untuk argsort");
+            return 0;
+        }
+        for (size_t i = 0; i < n; i++)
+            packed[i] = pack_key_index_int(arr[i], (uint32_t)i);
+        if (!sort_key_index32_int(packed, n, method)) {
+            free(packed);
+            return 0;
+        }
+        for (size_t i = 0; i < n; i++)
+            idx[i] = unpack_index(packed[i]);
+        free(packed);
+    } else {
+        IntKeyIndex64 *pairs = (IntKeyIndex64 *)malloc(n * sizeof(IntKeyIndex64));
+        if (!pairs) {
+            perror("Gagal alokasi memori untuk argsort 64-bit");
+            return 0;
+        }
+        for (size_t i = 0; i < n; i++) {
+            pairs[i].key = arr[i];
+            pairs[i].index = i;
+        }
+        if (!sort_key_index64_int(pairs, n, method)) {
+            free(pairs);
+            return 0;
+        }
+        for (size_t i = 0; i < n; i++)
+            idx[i] = (size_t)pairs[i].index;
+        free(pairs);
+    }
+    return 1;
+}
+
+/**
+ * @brief Menghitung permutasi indeks yang mengurutkan array string (argsort).
+ * @param arr Array pointer ke string (tidak diubah).
+ * @param idx Array output berukuran n untuk permutasi indeks.
+ * @param n Jumlah elemen.
+ * @param method Algoritma dasar yang dipakai.
+ * @return 1 jika berhasil, 0 jika alokasi memori gagal.
+ */
+int argsort_str(char *const arr[], size_t idx[], size_t n, ArgsortMethod method) {
+    StrKeyIndex *pairs = (StrKeyIndex *)malloc((n ? n : 1) * sizeof(StrKeyIndex));
+    if (!pairs) {
+        perror("Gagal alokasi memori untuk argsort string");
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++) {
+        pairs[i].key = arr[i];
+        pairs[i].index = i;
+    }
+    if (!sort_key_index_str(pairs, n, method)) {
+        free(pairs);
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++)
+        idx[i] = pairs[i].index;
+    free(pairs);
+    return 1;
+}
+
+/**
+ * @brief Menerapkan permutasi ke array record dalam satu pass gather.
+ * @prinsip dst[i] = src[idx[i]]. Penulisan ke dst berurutan (ramah cache),
+ *          hanya pembacaan dari src yang acak, dan setiap record dipindah tepat
+ *          satu kali, berbeda dengan sort langsung yang memindah record di
+ *          setiap swap/merge.
+ * @param src Array record sumber.
+ * @param dst Array record tujuan (tidak boleh sama dengan src).
+ * @param rec_size Ukuran satu record dalam byte.
+ * @param idx Permutasi hasil argsort.
+ * @param n Jumlah record.
+ */
+void apply_permutation(const void *src, void *dst, size_t rec_size, const size_t idx[], size_t n) {
+    const char *s = (const char *)src;
+    char *d = (char *)dst;
+    for (size_t i = 0; i < n; i++)
+        memcpy(d + i * rec_size, s + idx[i] * rec_size, rec_size);
+}
+
+// Sama seperti apply_permutation, tetapi indeks dibaca langsung dari pasangan
+// terkemas hasil sort_key_index32_int (tanpa array idx perantara).
+void apply_permutation_packed(const void *src, void *dst, size_t rec_size, const uint64_t packed[], size_t n) {
+    const char *s = (const char *)src;
+    char *d = (char *)dst;
+    for (size_t i = 0; i < n; i++)
+        memcpy(d + i * rec_size, s + (size_t)unpack_index(packed[i]) * rec_size, rec_size);
 }
 
 